@@ -0,0 +1,117 @@
+// KVStore's point index against std::unordered_map.
+//
+//   hash_index_bench [keys] [lookups]
+//
+// Inserts `keys` keys with 16-byte values into each, then does `lookups`
+// random successful lookups on one thread, and reports insert time,
+// lookup rate and memory per key. Run it with 10M keys or more to get
+// past the caches; 100M needs roughly 20GB.
+//
+// The KVStore row is the whole put path, not the hash table alone: each
+// insert also allocates its entry and value from the slabs and adds the
+// key to the ordered index, and its memory includes both. Lookups only
+// touch the hash table.
+
+#include "kv_store.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+static std::string keyFor(size_t i)
+{
+    return "key" + std::to_string(i);
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+// Resident set size from /proc. Only used for the map, which runs first:
+// memory it frees stays with malloc, so KVStore is measured by its own
+// accounting instead.
+static size_t residentBytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0, resident = 0;
+    statm >> pages >> resident;
+    return resident * 4096;
+}
+
+template <typename Lookup>
+static double lookupRate(size_t keys, size_t lookups, Lookup lookup)
+{
+    std::mt19937_64 rng(1);
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < lookups; ++i)
+        found += lookup(keyFor(rng() % keys));
+
+    double rate = lookups / secondsSince(start);
+
+    if (found != lookups)
+        std::fprintf(stderr, "missed %zu lookups\n", lookups - found);
+
+    return rate;
+}
+
+static void report(const char *name, double insertSec, double rate, size_t bytes, size_t keys)
+{
+    std::printf("%-14s %10.2f %14.0f %12.1f\n",
+                name, insertSec, rate, (double)bytes / keys);
+}
+
+int main(int argc, char **argv)
+{
+    size_t keys = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    size_t lookups = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5000000;
+    const std::string value(16, 'v');
+
+    std::printf("%-14s %10s %14s %12s\n",
+                "index", "insert s", "lookups/sec", "bytes/key");
+
+    {
+        size_t before = residentBytes();
+        std::unordered_map<std::string, std::string> map;
+        auto start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < keys; ++i)
+            map[keyFor(i)] = value;
+
+        double insertSec = secondsSince(start);
+        size_t bytes = residentBytes() - before;
+        double rate = lookupRate(keys, lookups, [&](const std::string &key)
+                                 { return map.find(key) != map.end(); });
+        report("unordered_map", insertSec, rate, bytes, keys);
+    }
+
+    {
+        KVStore store(1);
+        auto start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < keys; ++i)
+            store.put(keyFor(i), value);
+
+        double insertSec = secondsSince(start);
+        KVStore::MemoryStats mem = store.memoryStats();
+        ValueRef ref;
+        double rate = lookupRate(keys, lookups, [&](const std::string &key)
+                                 { return store.get(key, ref); });
+        report("KVStore", insertSec, rate,
+               mem.index_bytes + mem.slab_reserved_bytes, keys);
+
+        std::printf("# KVStore: %.1f index bytes/key (hash table and ordered index), "
+                    "%.1f slab bytes/key in use\n",
+                    (double)mem.index_bytes / keys,
+                    (double)mem.slab_used_bytes / keys);
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Get throughput of KVStore as reader threads are added.
+//
+//   kv_store_bench [shards] [keys] [max_threads] [ms_per_run]
+//
+// Runs every power-of-two thread count up to max_threads, once with a
+// single shard (one lock, the old layout) and once with `shards`.
+
+#include "kv_store.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::string keyFor(size_t i)
+{
+    return "key" + std::to_string(i);
+}
+
+static double runGets(KVStore &store, size_t keys, int threads, int ms)
+{
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> total{0};
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]
+                             {
+            std::mt19937_64 rng(t);
+            ValueRef value;
+            uint64_t ops = 0;
+
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                store.get(keyFor(rng() % keys), value);
+                ops++;
+            }
+
+            total += ops; });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    stop = true;
+
+    for (auto &w : workers)
+        w.join();
+
+    return total.load() * 1000.0 / ms;
+}
+
+int main(int argc, char **argv)
+{
+    size_t shards = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16;
+    size_t keys = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+    int maxThreads = argc > 3 ? std::atoi(argv[3])
+                              : (int)std::thread::hardware_concurrency();
+    int ms = argc > 4 ? std::atoi(argv[4]) : 1000;
+
+    std::printf("%8s %8s %14s\n", "shards", "threads", "gets/sec");
+
+    for (size_t n : {(size_t)1, shards})
+    {
+        KVStore store(n);
+
+        for (size_t i = 0; i < keys; ++i)
+            store.put(keyFor(i), std::string(64, 'v'));
+
+        KVStore::MemoryStats mem = store.memoryStats();
+        std::printf("# %zu keys, %zu logical bytes, %zu index bytes, "
+                    "%zu slab bytes in use (%.1f bytes/key)\n",
+                    mem.keys, mem.logical_bytes, mem.index_bytes,
+                    mem.slab_used_bytes,
+                    (double)(mem.index_bytes + mem.slab_used_bytes) / mem.keys);
+
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            double rate = runGets(store, keys, threads, ms);
+            std::printf("%8zu %8d %14.0f\n", n, threads, rate);
+        }
+    }
+
+    return 0;
+}
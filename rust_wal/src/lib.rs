@@ -1,5 +1,8 @@
+use std::collections::VecDeque;
+use std::ffi::c_void;
 use std::fs::{File, OpenOptions};
 use std::io::{Read, Seek, Write};
+use std::os::unix::io::AsRawFd;
 use std::sync::Mutex;
 
 use lazy_static::lazy_static;
@@ -7,105 +10,265 @@ use lazy_static::lazy_static;
 const SEGMENT_SIZE: u64 = 4 * 1024 * 1024; // 4MB
 const FSYNC_BATCH_BYTES: u64 = 64 * 1024; // ~64KB
 
+// Record layout: u64 index, u64 term, u32 kind, u32 key length, u32 value
+// length, then the key and value, all little-endian. kind is the caller's
+// entry type (EntryKind in src/operation.h); the WAL only stores it.
+const RECORD_HEADER: usize = 28;
+
+const PROT_READ: i32 = 1;
+const MAP_SHARED: i32 = 1;
+
+extern "C" {
+    fn mmap(addr: *mut c_void, len: usize, prot: i32, flags: i32, fd: i32, off: i64) -> *mut c_void;
+    fn munmap(addr: *mut c_void, len: usize) -> i32;
+}
+
 #[repr(C)]
 pub struct WalEntry {
     pub index: u64,
     pub term: u64,
+    pub kind: u32,
     pub key_ptr: *const u8,
     pub key_len: usize,
     pub val_ptr: *const u8,
     pub val_len: usize,
 }
 
+// A read-only shared mapping of a segment file. Its length is fixed when
+// it is made and may run past the end of the file: the segment is
+// appended into it, and since the mapping is of the page cache, new
+// records show up in it without remapping.
+struct Mapping {
+    ptr: *const u8,
+    len: usize,
+}
+
+// Only ever read, and only under GLOBAL.
+unsafe impl Send for Mapping {}
+
+impl Mapping {
+    fn new(file: &File, len: u64) -> Mapping {
+        let ptr = unsafe {
+            mmap(std::ptr::null_mut(), len as usize, PROT_READ, MAP_SHARED, file.as_raw_fd(), 0)
+        };
+
+        if ptr as isize == -1 {
+            panic!("mmap segment: {}", std::io::Error::last_os_error());
+        }
+
+        Mapping { ptr: ptr as *const u8, len: len as usize }
+    }
+
+    // The caller keeps [offset, offset + len) within the file.
+    fn bytes(&self, offset: u64, len: usize) -> &[u8] {
+        unsafe { std::slice::from_raw_parts(self.ptr.add(offset as usize), len) }
+    }
+}
+
+impl Drop for Mapping {
+    fn drop(&mut self) {
+        unsafe { munmap(self.ptr as *mut c_void, self.len) };
+    }
+}
+
+struct Segment {
+    id: u64,
+    map: Mapping,
+
+    // Highest index recorded in the segment, 0 if it has no records.
+    max_index: u64,
+}
+
+// Where a live entry's record is.
+#[derive(Clone, Copy)]
+struct Loc {
+    index: u64,
+    segment: u64,
+    offset: u64,
+    payload: u64, // key and value bytes
+}
+
 struct Wal {
     dir: String,
-    file: File,
-    entries: Vec<Vec<u8>>,
-    snapshot_index: u64,
 
-    segment_id: u64,
+    // Every segment holding a live entry, oldest first, then the current
+    // one, which file and size belong to. Ids are consecutive.
+    segments: VecDeque<Segment>,
+    file: File,
     size: u64,
+
+    // Live entries in log order, with consecutive indices. Readers get
+    // views into the mappings rather than copies, valid until the entry
+    // is truncated or compacted away.
+    entries: Vec<Loc>,
+    payload_bytes: u64,
+
+    // The snapshot is snapshot.bin (a full image, possibly followed by
+    // deltas) plus a delta file per index in snapshot_deltas, ascending.
+    // snapshot_index and snapshot_term come from the last of them.
+    has_snapshot: bool,
+    snapshot_deltas: Vec<u64>,
+    snapshot_index: u64,
+    snapshot_term: u64,
 }
 
 lazy_static! {
     static ref GLOBAL: Mutex<Option<Wal>> = Mutex::new(None);
+
+    // Snapshot being streamed in by wal_snapshot_write, under a temporary
+    // name until wal_snapshot_commit renames it into place. Kept out of
+    // GLOBAL so chunk writes never hold up appends and reads.
+    static ref SNAPSHOT_TMP: Mutex<Option<File>> = Mutex::new(None);
 }
 
-fn encode(index: u64, term: u64, key: &[u8], val: &[u8]) -> Vec<u8> {
-    let mut buf = Vec::new();
+fn encode(buf: &mut Vec<u8>, index: u64, term: u64, kind: u32, key: &[u8], val: &[u8]) {
     buf.extend(&index.to_le_bytes());
     buf.extend(&term.to_le_bytes());
+    buf.extend(&kind.to_le_bytes());
     buf.extend(&(key.len() as u32).to_le_bytes());
     buf.extend(&(val.len() as u32).to_le_bytes());
     buf.extend(key);
     buf.extend(val);
-    buf
 }
 
-fn decode_all(file: &File) -> Vec<Vec<u8>> {
-    // NOTE: file is opened with append(true). Reading will start at offset 0
-    // for a fresh handle. If you ever reuse the same handle after writing,
-    // you must seek to 0 first. Here we only decode on open.
-    let mut buf = Vec::new();
-    let mut f = file;
-    let _ = f.read_to_end(&mut buf);
-
-    let mut pos = 0;
-    let mut out = Vec::new();
-
-    while pos + 24 <= buf.len() {
-        let key_len = u32::from_le_bytes(buf[pos + 16..pos + 20].try_into().unwrap()) as usize;
-        let val_len = u32::from_le_bytes(buf[pos + 20..pos + 24].try_into().unwrap()) as usize;
-
-        let total = 24 + key_len + val_len;
-        if pos + total > buf.len() {
-            break;
-        }
+struct RecordHeader {
+    index: u64,
+    term: u64,
+    kind: u32,
+    klen: usize,
+    vlen: usize,
+}
 
-        out.push(buf[pos..pos + total].to_vec());
-        pos += total;
+fn decode_header(h: &[u8]) -> RecordHeader {
+    RecordHeader {
+        index: u64::from_le_bytes(h[0..8].try_into().unwrap()),
+        term: u64::from_le_bytes(h[8..16].try_into().unwrap()),
+        kind: u32::from_le_bytes(h[16..20].try_into().unwrap()),
+        klen: u32::from_le_bytes(h[20..24].try_into().unwrap()) as usize,
+        vlen: u32::from_le_bytes(h[24..28].try_into().unwrap()) as usize,
     }
-
-    out
 }
 
-fn open_segment(dir: &str, seg: u64) -> (File, u64) {
-    let path = format!("{}/{:08}.log", dir, seg);
+fn segment_path(dir: &str, id: u64) -> String {
+    format!("{}/{:08}.log", dir, id)
+}
 
+fn open_segment(dir: &str, id: u64) -> (File, u64) {
     let file = OpenOptions::new()
         .create(true)
         .append(true)
         .read(true)
-        .open(&path)
+        .open(segment_path(dir, id))
         .unwrap();
 
     let size = file.metadata().unwrap().len();
     (file, size)
 }
 
-fn rotate_if_needed(wal: &mut Wal) {
-    if wal.size < SEGMENT_SIZE {
-        return;
+// Ids of the segment files in dir, ascending.
+fn list_segments(dir: &str) -> Vec<u64> {
+    let mut out: Vec<u64> = match std::fs::read_dir(dir) {
+        Ok(it) => it
+            .filter_map(|e| e.ok())
+            .filter_map(|e| e.file_name().into_string().ok()?.strip_suffix(".log")?.parse().ok())
+            .collect(),
+        Err(_) => Vec::new(),
+    };
+
+    out.sort_unstable();
+    out
+}
+
+// Indexes the records in the first size bytes of segment, adding those
+// above snapshot_index to entries. Returns where the last whole record
+// ends; anything after it is a write torn by a crash.
+fn scan_segment(
+    segment: &mut Segment,
+    size: u64,
+    snapshot_index: u64,
+    entries: &mut Vec<Loc>,
+    payload_bytes: &mut u64,
+) -> u64 {
+    let mut pos = 0;
+
+    while pos + RECORD_HEADER as u64 <= size {
+        let h = decode_header(segment.map.bytes(pos, RECORD_HEADER));
+        let (index, payload) = (h.index, (h.klen + h.vlen) as u64);
+
+        if pos + RECORD_HEADER as u64 + payload > size {
+            break;
+        }
+
+        if index > snapshot_index {
+            entries.push(Loc { index, segment: segment.id, offset: pos, payload });
+            *payload_bytes += payload;
+        }
+
+        segment.max_index = segment.max_index.max(index);
+        pos += RECORD_HEADER as u64 + payload;
     }
 
-    wal.segment_id += 1;
-    let (file, size) = open_segment(&wal.dir, wal.segment_id);
+    pos
+}
+
+fn new_segment(wal: &mut Wal, window: u64) {
+    let id = wal.segments.back().map_or(1, |s| s.id + 1);
+    let (file, size) = open_segment(&wal.dir, id);
 
+    wal.segments.push_back(Segment { id, map: Mapping::new(&file, window), max_index: 0 });
     wal.file = file;
     wal.size = size;
 }
 
-fn find_latest_segment(dir: &str) -> u64 {
-    let mut seg = 1;
-    loop {
-        let next = format!("{}/{:08}.log", dir, seg + 1);
-        if std::path::Path::new(&next).exists() {
-            seg += 1;
-        } else {
-            break;
-        }
+// Makes room for n more bytes in the current segment. A segment never
+// outgrows its mapping, which stays put for as long as the segment
+// lives so that views into it do too; a write that would not fit starts
+// a new segment instead.
+fn reserve(wal: &mut Wal, n: u64) {
+    let window = wal.segments.back().unwrap().map.len as u64;
+
+    if wal.size + n <= window {
+        return;
+    }
+
+    let window = SEGMENT_SIZE.max(n);
+
+    if wal.size == 0 {
+        // Nothing in it to point at, so it can be mapped again, bigger.
+        let segment = wal.segments.back_mut().unwrap();
+        segment.map = Mapping::new(&wal.file, window);
+        return;
+    }
+
+    new_segment(wal, window);
+}
+
+// Appends buf, the records for locs in order, to the current segment and
+// makes them live. Each loc's offset is relative to buf on the way in.
+fn append_records(wal: &mut Wal, buf: &[u8], locs: Vec<Loc>) {
+    reserve(wal, buf.len() as u64);
+
+    wal.file.write_all(buf).unwrap();
+
+    let before = wal.size;
+    wal.size += buf.len() as u64;
+
+    // fsync batching (~64KB): at most once per write, and only when it
+    // crosses a batch boundary.
+    if before / FSYNC_BATCH_BYTES != wal.size / FSYNC_BATCH_BYTES {
+        wal.file.sync_data().unwrap();
+    }
+
+    let segment = wal.segments.back_mut().unwrap();
+
+    for mut loc in locs {
+        loc.segment = segment.id;
+        loc.offset += before;
+        segment.max_index = segment.max_index.max(loc.index);
+
+        wal.payload_bytes += loc.payload;
+        wal.entries.push(loc);
     }
-    seg
 }
 
 #[no_mangle]
@@ -120,20 +283,74 @@ pub extern "C" fn wal_open(path: *const i8) -> i32 {
     // Treat p as a directory now
     std::fs::create_dir_all(p).unwrap();
 
-    let seg = find_latest_segment(p);
-    let (file, size) = open_segment(p, seg);
+    let base = read_snapshot_last(&format!("{}/snapshot.bin", p)).map(|(index, _)| index);
+    let mut deltas = list_deltas(p);
 
-    // Load entries from ONLY the latest segment into memory.
-    // (We keep this simple for now. True multi-segment replay comes later)
-    let entries = decode_all(&file);
+    // Deltas at or below the base's index were merged into it; a crash
+    // kept them from being removed.
+    for &index in deltas.iter().filter(|&&i| base.map_or(true, |b| i <= b)) {
+        let _ = std::fs::remove_file(delta_path(p, index));
+    }
+    deltas.retain(|&i| base.map_or(false, |b| i > b));
+
+    let snapshot_index = deltas.last().copied().or(base).unwrap_or(0);
+    let snapshot_term = match deltas.last() {
+        Some(&index) => read_snapshot_last(&delta_path(p, index)),
+        None => read_snapshot_last(&format!("{}/snapshot.bin", p)),
+    }
+    .map_or(0, |(_, term)| term);
+
+    let mut ids = list_segments(p);
+    if ids.is_empty() {
+        ids.push(1);
+    }
+
+    let mut segments = VecDeque::new();
+    let mut entries = Vec::new();
+    let mut payload_bytes = 0;
+    let mut current = None;
+
+    // Map every segment and index its records in place; nothing is read
+    // into memory.
+    for (i, &id) in ids.iter().enumerate() {
+        let (file, size) = open_segment(p, id);
+
+        let mut segment = Segment {
+            id,
+            map: Mapping::new(&file, SEGMENT_SIZE.max(size)),
+            max_index: 0,
+        };
+
+        let end = scan_segment(&mut segment, size, snapshot_index, &mut entries, &mut payload_bytes);
+
+        if i + 1 == ids.len() {
+            if end < size {
+                file.set_len(end).unwrap();
+            }
+            current = Some((file, end));
+        } else if segments.is_empty() && segment.max_index <= snapshot_index {
+            // Compacted, but a crash came before it was removed.
+            drop(segment);
+            let _ = std::fs::remove_file(segment_path(p, id));
+            continue;
+        }
+
+        segments.push_back(segment);
+    }
+
+    let (file, size) = current.unwrap();
 
     let wal = Wal {
         dir: p.to_string(),
+        segments,
         file,
-        entries,
-        snapshot_index: 0,
-        segment_id: seg,
         size,
+        entries,
+        payload_bytes,
+        has_snapshot: base.is_some(),
+        snapshot_index,
+        snapshot_term,
+        snapshot_deltas: deltas,
     };
 
     *GLOBAL.lock().unwrap() = Some(wal);
@@ -144,6 +361,7 @@ pub extern "C" fn wal_open(path: *const i8) -> i32 {
 pub extern "C" fn wal_append(
     index: u64,
     term: u64,
+    kind: u32,
     key_ptr: *const u8,
     key_len: usize,
     val_ptr: *const u8,
@@ -155,25 +373,44 @@ pub extern "C" fn wal_append(
     let key = unsafe { std::slice::from_raw_parts(key_ptr, key_len) };
     let val = unsafe { std::slice::from_raw_parts(val_ptr, val_len) };
 
-    let rec = encode(index, term, key, val);
+    let mut rec = Vec::with_capacity(RECORD_HEADER + key_len + val_len);
+    encode(&mut rec, index, term, kind, key, val);
 
-    // Write
-    wal.file.write_all(&rec).unwrap();
+    let loc = Loc { index, segment: 0, offset: 0, payload: (key_len + val_len) as u64 };
+    append_records(wal, &rec, vec![loc]);
 
-    // Update size first, then decide rotation and syncing
-    wal.size += rec.len() as u64;
+    0
+}
 
-    // fsync batching (~64KB)
-    // Only sync when we cross a batch boundary.
-    if wal.size % FSYNC_BATCH_BYTES < rec.len() as u64 {
-        wal.file.sync_data().unwrap();
+#[no_mangle]
+pub extern "C" fn wal_append_batch(entries: *const WalEntry, count: usize) -> i32 {
+    if entries.is_null() && count > 0 {
+        return -1;
     }
 
-    // Rotate if needed
-    rotate_if_needed(wal);
+    let mut g = GLOBAL.lock().unwrap();
+    let wal = g.as_mut().unwrap();
+
+    let entries = unsafe { std::slice::from_raw_parts(entries, count) };
+
+    // Encode the whole group up front so it hits the file in one write.
+    let mut buf = Vec::new();
+    let mut locs = Vec::with_capacity(count);
+
+    for e in entries {
+        let key = unsafe { std::slice::from_raw_parts(e.key_ptr, e.key_len) };
+        let val = unsafe { std::slice::from_raw_parts(e.val_ptr, e.val_len) };
+
+        locs.push(Loc {
+            index: e.index,
+            segment: 0,
+            offset: buf.len() as u64,
+            payload: (e.key_len + e.val_len) as u64,
+        });
+        encode(&mut buf, e.index, e.term, e.kind, key, val);
+    }
 
-    // In-memory copy (still needed for your wal_read() API)
-    wal.entries.push(rec);
+    append_records(wal, &buf, locs);
 
     0
 }
@@ -188,35 +425,113 @@ pub extern "C" fn wal_count() -> u64 {
         .unwrap_or(0)
 }
 
+// Key and value bytes of the live entries, as recorded; they sit in the
+// page cache, not in memory of ours.
 #[no_mangle]
-pub extern "C" fn wal_read(idx: u64, entry: *mut WalEntry) -> i32 {
+pub extern "C" fn wal_bytes() -> u64 {
+    GLOBAL
+        .lock()
+        .unwrap()
+        .as_ref()
+        .map(|w| w.payload_bytes)
+        .unwrap_or(0)
+}
+
+// Fills out with up to cap entries, starting at log index from, and
+// returns how many. Keys and values point into the mapped segments and
+// stay valid until those entries are truncated or compacted away.
+#[no_mangle]
+pub extern "C" fn wal_read(from: u64, out: *mut WalEntry, cap: usize) -> usize {
     let g = GLOBAL.lock().unwrap();
     let wal = g.as_ref().unwrap();
 
-    if idx >= wal.entries.len() as u64 {
-        return -1;
+    let first = match wal.entries.first() {
+        Some(loc) if from >= loc.index => (from - loc.index) as usize,
+        _ => return 0,
+    };
+
+    if first >= wal.entries.len() || cap == 0 {
+        return 0;
     }
 
-    let rec = &wal.entries[idx as usize];
+    let locs = &wal.entries[first..wal.entries.len().min(first + cap)];
+    let out = unsafe { std::slice::from_raw_parts_mut(out, locs.len()) };
+    let base = wal.segments[0].id;
+
+    for (loc, e) in locs.iter().zip(out.iter_mut()) {
+        let map = &wal.segments[(loc.segment - base) as usize].map;
+        let h = decode_header(map.bytes(loc.offset, RECORD_HEADER));
+        let key = map.bytes(loc.offset + RECORD_HEADER as u64, h.klen);
+
+        *e = WalEntry {
+            index: h.index,
+            term: h.term,
+            kind: h.kind,
+            key_ptr: key.as_ptr(),
+            key_len: h.klen,
+            val_ptr: unsafe { key.as_ptr().add(h.klen) },
+            val_len: h.vlen,
+        };
+    }
+
+    locs.len()
+}
+
+// Last index and term covered by the snapshot file at path, from the
+// header of the last image in it (see src/snapshot_format.h), or None if
+// there is none.
+fn read_snapshot_last(path: &str) -> Option<(u64, u64)> {
+    let mut file = File::open(path).ok()?;
+    let size = file.metadata().ok()?.len();
+
+    let mut pos = 0;
+    let mut last = None;
+
+    // Images are laid end to end; hop from header to header.
+    while pos < size {
+        let mut header = [0u8; 48];
 
-    let index = u64::from_le_bytes(rec[0..8].try_into().unwrap());
-    let term = u64::from_le_bytes(rec[8..16].try_into().unwrap());
-    let klen = u32::from_le_bytes(rec[16..20].try_into().unwrap()) as usize;
-    let vlen = u32::from_le_bytes(rec[20..24].try_into().unwrap()) as usize;
+        file.seek(std::io::SeekFrom::Start(pos)).ok()?;
+        file.read_exact(&mut header).ok()?;
 
-    let key_ptr = rec[24..24 + klen].as_ptr();
-    let val_ptr = rec[24 + klen..24 + klen + vlen].as_ptr();
+        if &header[..8] != b"KVSNAP\r\n" {
+            return None;
+        }
+
+        last = Some((
+            u64::from_le_bytes(header[16..24].try_into().unwrap()),
+            u64::from_le_bytes(header[24..32].try_into().unwrap()),
+        ));
 
-    unsafe {
-        (*entry).index = index;
-        (*entry).term = term;
-        (*entry).key_ptr = key_ptr;
-        (*entry).key_len = klen;
-        (*entry).val_ptr = val_ptr;
-        (*entry).val_len = vlen;
+        let data_bytes = u64::from_le_bytes(header[40..48].try_into().unwrap());
+        pos += 48 + data_bytes + 4;
     }
 
-    0
+    last
+}
+
+fn delta_path(dir: &str, index: u64) -> String {
+    format!("{}/snapshot.{:020}.delta", dir, index)
+}
+
+// Indices of the delta files in dir, ascending.
+fn list_deltas(dir: &str) -> Vec<u64> {
+    let mut out: Vec<u64> = match std::fs::read_dir(dir) {
+        Ok(it) => it
+            .filter_map(|e| e.ok())
+            .filter_map(|e| {
+                let name = e.file_name().into_string().ok()?;
+                name.strip_prefix("snapshot.")?
+                    .strip_suffix(".delta")?
+                    .parse()
+                    .ok()
+            })
+            .collect(),
+        Err(_) => Vec::new(),
+    };
+
+    out.sort_unstable();
+    out
 }
 
 #[no_mangle]
@@ -225,87 +540,284 @@ pub extern "C" fn wal_last_index() -> u64 {
         .lock()
         .unwrap()
         .as_ref()
-        .map(|w| w.entries.len() as u64)
+        .map(|w| w.entries.last().map(|l| l.index).unwrap_or(w.snapshot_index))
         .unwrap_or(0)
 }
 
+// Last index the snapshot covers; the log holds only entries after it.
+#[no_mangle]
+pub extern "C" fn wal_snapshot_index() -> u64 {
+    GLOBAL
+        .lock()
+        .unwrap()
+        .as_ref()
+        .map(|w| w.snapshot_index)
+        .unwrap_or(0)
+}
+
+// Term of the entry at index: from its record, or from the snapshot's
+// header if the snapshot ends there. 0 for index 0, before the first
+// entry; -1 if compacted below the snapshot or not written yet.
+#[no_mangle]
+pub extern "C" fn wal_term_at(index: u64) -> i64 {
+    let g = GLOBAL.lock().unwrap();
+    let wal = g.as_ref().unwrap();
+
+    if index == 0 {
+        return 0;
+    }
+
+    if index == wal.snapshot_index {
+        return wal.snapshot_term as i64;
+    }
+
+    let loc = match wal.entries.first() {
+        Some(first) if index >= first.index => wal.entries.get((index - first.index) as usize),
+        _ => None,
+    };
+
+    match loc {
+        Some(loc) => {
+            let map = &wal.segments[(loc.segment - wal.segments[0].id) as usize].map;
+            decode_header(map.bytes(loc.offset, RECORD_HEADER)).term as i64
+        }
+        None => -1,
+    }
+}
+
 #[no_mangle]
 pub extern "C" fn wal_truncate_from(index: u64) -> i32 {
     let mut g = GLOBAL.lock().unwrap();
     let wal = g.as_mut().unwrap();
 
-    if index >= wal.entries.len() as u64 {
+    // Keep every entry up to and including `index`. Entries are indexed
+    // from the last snapshot, not from position 0.
+    let keep = wal.entries.iter().take_while(|l| l.index <= index).count();
+
+    if keep == wal.entries.len() {
         return 0;
     }
 
-    wal.entries.truncate(index as usize);
+    let cut = wal.entries[keep];
 
-    // Rewrite *current* segment file from scratch.
-    // (True multi-segment truncate comes in Stage 5+.)
-    wal.file.set_len(0).unwrap();
-    wal.file.seek(std::io::SeekFrom::Start(0)).unwrap();
+    for loc in wal.entries.drain(keep..) {
+        wal.payload_bytes -= loc.payload;
+    }
 
-    for rec in &wal.entries {
-        wal.file.write_all(rec).unwrap();
+    // Segments after the first dropped record go whole; its own is cut
+    // short at it, and appends carry on from there.
+    while wal.segments.back().unwrap().id > cut.segment {
+        let segment = wal.segments.pop_back().unwrap();
+        let _ = std::fs::remove_file(segment_path(&wal.dir, segment.id));
     }
 
-    wal.file.flush().unwrap();
-    wal.size = wal.file.metadata().unwrap().len();
+    let (file, _) = open_segment(&wal.dir, cut.segment);
+    file.set_len(cut.offset).unwrap();
+
+    let segment = wal.segments.back_mut().unwrap();
+    segment.max_index = segment.max_index.min(index);
+
+    wal.file = file;
+    wal.size = cut.offset;
 
     0
 }
 
+fn snapshot_tmp_path() -> String {
+    format!("{}/snapshot.bin.tmp", GLOBAL.lock().unwrap().as_ref().unwrap().dir)
+}
+
+// Starts a snapshot file, replacing any unfinished one.
 #[no_mangle]
-pub extern "C" fn wal_create_snapshot(data_ptr: *const u8, data_len: usize, last_index: u64) -> i32 {
-    let mut g = GLOBAL.lock().unwrap();
-    let wal = g.as_mut().unwrap();
+pub extern "C" fn wal_snapshot_begin() -> i32 {
+    match File::create(snapshot_tmp_path()) {
+        Ok(file) => {
+            *SNAPSHOT_TMP.lock().unwrap() = Some(file);
+            0
+        }
+        Err(_) => -1,
+    }
+}
 
+// Appends the next chunk of the snapshot started by wal_snapshot_begin.
+// Only the chunk is held in memory, never the whole image.
+#[no_mangle]
+pub extern "C" fn wal_snapshot_write(data_ptr: *const u8, data_len: usize) -> i32 {
     let data = unsafe { std::slice::from_raw_parts(data_ptr, data_len) };
 
-    let path = format!("{}/snapshot.bin", wal.dir);
-    std::fs::write(&path, data).unwrap();
+    match SNAPSHOT_TMP.lock().unwrap().as_mut().map(|f| f.write_all(data)) {
+        Some(Ok(())) => 0,
+        _ => -1,
+    }
+}
+
+// Drops the snapshot being written. The previous one stays in place.
+#[no_mangle]
+pub extern "C" fn wal_snapshot_abort() -> i32 {
+    if SNAPSHOT_TMP.lock().unwrap().take().is_some() {
+        let _ = std::fs::remove_file(snapshot_tmp_path());
+    }
+
+    0
+}
+
+// Makes the snapshot streamed since wal_snapshot_begin durable, ready to
+// be installed, and returns its path. Runs before GLOBAL is taken: the
+// flush is the slow part.
+fn finish_snapshot_tmp() -> Option<String> {
+    let file = SNAPSHOT_TMP.lock().unwrap().take()?;
+    let path = snapshot_tmp_path();
+
+    if file.sync_all().is_err() {
+        let _ = std::fs::remove_file(&path);
+        return None;
+    }
+
+    Some(path)
+}
+
+// Renames the file at src, which the caller has made durable, to dst. A
+// crash at any point leaves either the old file or the new one, never a
+// partial file.
+fn install_file(wal: &Wal, src: &str, dst: &str) -> i32 {
+    if std::fs::rename(src, dst).is_err() {
+        let _ = std::fs::remove_file(src);
+        return -1;
+    }
+
+    // Persist the rename itself.
+    if let Ok(dir) = File::open(&wal.dir) {
+        let _ = dir.sync_all();
+    }
 
+    0
+}
+
+// Drops the log up to last_index, which the snapshot file at path now
+// covers.
+fn compact_log(wal: &mut Wal, last_index: u64, path: &str) {
     wal.snapshot_index = last_index;
+    wal.snapshot_term = read_snapshot_last(path).map_or(0, |(_, term)| term);
+
+    let covered = wal.entries.iter().take_while(|l| l.index <= last_index).count();
 
-    // compact log below snapshot (in-memory)
-    if last_index > 0 && last_index <= wal.entries.len() as u64 {
-        wal.entries.drain(..last_index as usize);
+    for loc in wal.entries.drain(..covered) {
+        wal.payload_bytes -= loc.payload;
     }
 
-    // rewrite current segment
-    wal.file.set_len(0).unwrap();
-    wal.file.seek(std::io::SeekFrom::Start(0)).unwrap();
+    // Segments wholly below the snapshot are removed, never rewritten;
+    // the current one stays for appends.
+    while wal.segments.len() > 1 && wal.segments[0].max_index <= last_index {
+        let segment = wal.segments.pop_front().unwrap();
+        let _ = std::fs::remove_file(segment_path(&wal.dir, segment.id));
+    }
+}
+
+// Renames the snapshot file at src over snapshot.bin and compacts the log
+// up to last_index. The new file covers every delta, so they go.
+fn replace_snapshot(wal: &mut Wal, src: &str, last_index: u64) -> i32 {
+    let path = format!("{}/snapshot.bin", wal.dir);
 
-    for rec in &wal.entries {
-        wal.file.write_all(rec).unwrap();
+    if install_file(wal, src, &path) != 0 {
+        return -1;
     }
 
-    wal.file.flush().unwrap();
-    wal.size = wal.file.metadata().unwrap().len();
+    for index in wal.snapshot_deltas.drain(..) {
+        let _ = std::fs::remove_file(delta_path(&wal.dir, index));
+    }
 
+    wal.has_snapshot = true;
+    compact_log(wal, last_index, &path);
     0
 }
 
+// Installs the snapshot streamed since wal_snapshot_begin.
 #[no_mangle]
-pub extern "C" fn wal_load_snapshot(
-    out_ptr: *mut *const u8,
-    out_len: *mut usize,
-    out_index: *mut u64,
-) -> i32 {
+pub extern "C" fn wal_snapshot_commit(last_index: u64) -> i32 {
+    let tmp = match finish_snapshot_tmp() {
+        Some(tmp) => tmp,
+        None => return -1,
+    };
+
+    let mut g = GLOBAL.lock().unwrap();
+    let wal = g.as_mut().unwrap();
+
+    replace_snapshot(wal, &tmp, last_index)
+}
+
+// Installs a complete snapshot file written elsewhere, such as one
+// received from the leader. The file must be in the WAL directory so the
+// rename stays on one filesystem.
+#[no_mangle]
+pub extern "C" fn wal_snapshot_adopt(path: *const i8, last_index: u64) -> i32 {
+    if path.is_null() {
+        return -1;
+    }
+
+    let src = unsafe { std::ffi::CStr::from_ptr(path) };
+
+    let src = match src.to_str() {
+        Ok(src) => src.to_string(),
+        Err(_) => return -1,
+    };
+
+    if File::open(&src).and_then(|f| f.sync_all()).is_err() {
+        let _ = std::fs::remove_file(&src);
+        return -1;
+    }
+
+    let mut g = GLOBAL.lock().unwrap();
+    let wal = g.as_mut().unwrap();
+
+    replace_snapshot(wal, &src, last_index)
+}
+
+// Installs the snapshot streamed since wal_snapshot_begin as a delta on
+// top of the current snapshot, rather than in place of it.
+#[no_mangle]
+pub extern "C" fn wal_snapshot_commit_delta(last_index: u64) -> i32 {
+    let tmp = match finish_snapshot_tmp() {
+        Some(tmp) => tmp,
+        None => return -1,
+    };
+
+    let mut g = GLOBAL.lock().unwrap();
+    let wal = g.as_mut().unwrap();
+
+    if !wal.has_snapshot {
+        let _ = std::fs::remove_file(&tmp);
+        return -1;
+    }
+
+    let path = delta_path(&wal.dir, last_index);
+
+    if install_file(wal, &tmp, &path) != 0 {
+        return -1;
+    }
+
+    wal.snapshot_deltas.push(last_index);
+    compact_log(wal, last_index, &path);
+    0
+}
+
+// Writes up to cap delta indices, ascending, to out, and returns how many
+// deltas there are; the files are snapshot.<index>.delta in the WAL
+// directory, after snapshot.bin. Returns -1 if there is no snapshot.
+#[no_mangle]
+pub extern "C" fn wal_snapshot_chain(out: *mut u64, cap: usize) -> i64 {
     let g = GLOBAL.lock().unwrap();
     let wal = g.as_ref().unwrap();
 
-    let path = format!("{}/snapshot.bin", wal.dir);
+    if !wal.has_snapshot {
+        return -1;
+    }
 
-    if let Ok(data) = std::fs::read(&path) {
-        unsafe {
-            *out_ptr = data.as_ptr();
-            *out_len = data.len();
-            *out_index = wal.snapshot_index;
-        }
-        std::mem::forget(data);
-        return 0;
+    let n = wal.snapshot_deltas.len().min(cap);
+
+    if n > 0 {
+        let out = unsafe { std::slice::from_raw_parts_mut(out, n) };
+        out.copy_from_slice(&wal.snapshot_deltas[..n]);
     }
 
-    -1
-}
\ No newline at end of file
+    wal.snapshot_deltas.len() as i64
+}
@@ -1,45 +1,159 @@
 #include "wal_adapter.h"
+#include <cinttypes>
+#include <cstdio>
+
+namespace
+{
+    // The Rust log stores one key and value per record, tagged with the
+    // entry's kind. A MultiPut entry has no key, and its writes are
+    // packed into the value as (u32 key length, key, u32 value length,
+    // value)*, little-endian.
+    void putLength(std::string &out, size_t n)
+    {
+        for (int i = 0; i < 4; ++i)
+            out.push_back(static_cast<char>((n >> (8 * i)) & 0xff));
+    }
+
+    bool getLength(std::string_view in, size_t &pos, size_t &n)
+    {
+        if (in.size() - pos < 4)
+            return false;
+
+        n = 0;
+        for (int i = 0; i < 4; ++i)
+            n |= (size_t)(uint8_t)in[pos + i] << (8 * i);
+
+        pos += 4;
+        return in.size() - pos >= n;
+    }
+
+    std::string encodeBatch(const Operation &op)
+    {
+        std::string out;
+
+        for (const auto &[key, value] : op.batch)
+        {
+            putLength(out, key.size());
+            out += key;
+            putLength(out, value.size());
+            out += value;
+        }
+        return out;
+    }
+
+    // The writes point into in.
+    void decodeBatch(std::string_view in, LogEntry &entry)
+    {
+        size_t pos = 0, n;
+
+        while (pos < in.size())
+        {
+            std::pair<std::string_view, std::string_view> write;
+
+            if (!getLength(in, pos, n))
+                break;
+            write.first = in.substr(pos, n);
+            pos += n;
+
+            if (!getLength(in, pos, n))
+                break;
+            write.second = in.substr(pos, n);
+            pos += n;
+
+            entry.batch.push_back(write);
+        }
+    }
+}
 
 WALAdapter::WALAdapter(const std::string &file)
     : file_(file)
 {
     wal_open(file_.c_str());
-    cache_ = replay(); // load existing WAL into memory
 }
 
 void WALAdapter::append(const Operation &op)
 {
+    bool batch = op.kind == EntryKind::BATCH;
+    std::string encoded = batch ? encodeBatch(op) : std::string();
+    const std::string &value = batch ? encoded : op.value;
+
     wal_append(
         op.index,
         op.term,
+        (uint32_t)op.kind,
         (const uint8_t *)op.key.data(),
-        op.key.size(),
-        (const uint8_t *)op.value.data(),
-        op.value.size());
-
-    cache_.push_back(op);
+        batch ? 0 : op.key.size(),
+        (const uint8_t *)value.data(),
+        value.size());
 }
 
-std::vector<Operation> WALAdapter::replay()
+void WALAdapter::appendBatch(const std::vector<Operation> &ops)
 {
-    std::vector<Operation> out;
+    std::vector<WalEntry> entries;
+    entries.reserve(ops.size());
 
-    uint64_t n = wal_count();
+    // Packed MultiPut values, kept alive until the append returns.
+    std::vector<std::string> encoded(ops.size());
 
-    for (uint64_t i = 0; i < n; i++)
+    for (size_t i = 0; i < ops.size(); ++i)
     {
+        const Operation &op = ops[i];
+        bool batch = op.kind == EntryKind::BATCH;
+
+        if (batch)
+            encoded[i] = encodeBatch(op);
+
+        const std::string &value = batch ? encoded[i] : op.value;
+
         WalEntry e;
-        wal_read(i, &e);
+        e.index = op.index;
+        e.term = op.term;
+        e.kind = (uint32_t)op.kind;
+        e.key_ptr = (const uint8_t *)op.key.data();
+        e.key_len = batch ? 0 : op.key.size();
+        e.val_ptr = (const uint8_t *)value.data();
+        e.val_len = value.size();
+        entries.push_back(e);
+    }
+
+    wal_append_batch(entries.data(), entries.size());
+}
+
+size_t WALAdapter::count() const
+{
+    return wal_count();
+}
+
+size_t WALAdapter::bytes() const
+{
+    return wal_bytes();
+}
+
+void WALAdapter::read(uint64_t from, size_t max, std::vector<LogEntry> &out) const
+{
+    std::vector<WalEntry> entries(max);
+    entries.resize(wal_read(from, entries.data(), max));
 
-        Operation op;
-        op.index = e.index;
-        op.term = e.term;
-        op.key.assign((char *)e.key_ptr, e.key_len);
-        op.value.assign((char *)e.val_ptr, e.val_len);
+    out.resize(entries.size());
 
-        out.push_back(op);
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const WalEntry &e = entries[i];
+        LogEntry &entry = out[i];
+
+        entry.index = e.index;
+        entry.term = e.term;
+        entry.kind = (EntryKind)e.kind;
+        entry.key = std::string_view((const char *)e.key_ptr, e.key_len);
+        entry.value = std::string_view((const char *)e.val_ptr, e.val_len);
+        entry.batch.clear();
+
+        if (entry.kind == EntryKind::BATCH)
+        {
+            decodeBatch(entry.value, entry);
+            entry.value = std::string_view();
+        }
     }
-    return out;
 }
 
 uint64_t WALAdapter::lastIndex() const
@@ -50,34 +164,74 @@ uint64_t WALAdapter::lastIndex() const
 void WALAdapter::truncateFrom(uint64_t index)
 {
     wal_truncate_from(index);
+}
+
+uint64_t WALAdapter::snapshotIndex() const
+{
+    return wal_snapshot_index();
+}
+
+int64_t WALAdapter::termAt(uint64_t index) const
+{
+    return wal_term_at(index);
+}
+
+bool WALAdapter::beginSnapshot()
+{
+    return wal_snapshot_begin() == 0;
+}
+
+bool WALAdapter::writeSnapshot(const char *data, size_t size)
+{
+    return wal_snapshot_write((const uint8_t *)data, size) == 0;
+}
 
-    if (index < cache_.size())
-        cache_.resize(index);
+bool WALAdapter::commitSnapshot(uint64_t lastIndex)
+{
+    return wal_snapshot_commit(lastIndex) == 0;
 }
 
-void WALAdapter::createSnapshot(const std::string &data, uint64_t lastIndex)
+bool WALAdapter::adoptSnapshot(const std::string &path, uint64_t lastIndex)
 {
-    wal_create_snapshot(
-        (const uint8_t *)data.data(),
-        data.size(),
-        lastIndex);
+    return wal_snapshot_adopt(path.c_str(), lastIndex) == 0;
+}
 
-    if (lastIndex <= cache_.size())
-        cache_.erase(cache_.begin(), cache_.begin() + lastIndex);
+bool WALAdapter::commitDelta(uint64_t lastIndex)
+{
+    return wal_snapshot_commit_delta(lastIndex) == 0;
 }
 
-bool WALAdapter::loadSnapshot(std::string &data, uint64_t &index)
+std::vector<std::string> WALAdapter::snapshotChain() const
 {
-    const uint8_t *ptr;
-    size_t len;
-    uint64_t idx;
+    std::vector<std::string> paths;
+    std::vector<uint64_t> deltas;
+
+    // A delta can land between the two calls; ask again until it fits.
+    int64_t n = wal_snapshot_chain(nullptr, 0);
+
+    while (n > (int64_t)deltas.size())
+    {
+        deltas.resize(n);
+        n = wal_snapshot_chain(deltas.data(), deltas.size());
+    }
+
+    if (n < 0)
+        return paths;
 
-    int rc = wal_load_snapshot(&ptr, &len, &idx);
+    deltas.resize(n);
+    paths.push_back(snapshotPath());
+
+    for (uint64_t index : deltas)
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "/snapshot.%020" PRIu64 ".delta", index);
+        paths.push_back(file_ + name);
+    }
 
-    if (rc != 0)
-        return false;
+    return paths;
+}
 
-    data.assign((char *)ptr, len);
-    index = idx;
-    return true;
-}
\ No newline at end of file
+void WALAdapter::abortSnapshot()
+{
+    wal_snapshot_abort();
+}
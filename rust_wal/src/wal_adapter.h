@@ -10,6 +10,7 @@ extern "C"
     {
         uint64_t index;
         uint64_t term;
+        uint32_t kind;
         const uint8_t *key_ptr;
         size_t key_len;
         const uint8_t *val_ptr;
@@ -17,15 +18,24 @@ extern "C"
     };
 
     int wal_open(const char *path);
-    int wal_append(uint64_t, uint64_t,
+    int wal_append(uint64_t, uint64_t, uint32_t,
                    const uint8_t *, size_t,
                    const uint8_t *, size_t);
+    int wal_append_batch(const WalEntry *, size_t);
     uint64_t wal_count();
-    int wal_read(uint64_t, WalEntry *);
+    uint64_t wal_bytes();
+    size_t wal_read(uint64_t, WalEntry *, size_t);
     uint64_t wal_last_index();
+    uint64_t wal_snapshot_index();
+    int64_t wal_term_at(uint64_t);
     int wal_truncate_from(uint64_t);
-    int wal_create_snapshot(const uint8_t *, size_t, uint64_t);
-    int wal_load_snapshot(const uint8_t **, size_t *, uint64_t *);
+    int wal_snapshot_begin();
+    int wal_snapshot_write(const uint8_t *, size_t);
+    int wal_snapshot_commit(uint64_t);
+    int wal_snapshot_abort();
+    int wal_snapshot_adopt(const char *, uint64_t);
+    int wal_snapshot_commit_delta(uint64_t);
+    int64_t wal_snapshot_chain(uint64_t *, size_t);
 }
 
 class WALAdapter
@@ -34,17 +44,61 @@ public:
     WALAdapter(const std::string &file);
 
     void append(const Operation &op);
-    std::vector<Operation> replay();
+    void appendBatch(const std::vector<Operation> &ops);
 
-    const std::vector<Operation> &inMemoryLog() const { return cache_; }
+    // Entries in the log; they live in its mapped segment files, not in
+    // memory.
+    size_t count() const;
+
+    // Key and value bytes of those entries.
+    size_t bytes() const;
+
+    // Replaces out with up to max entries, starting at the given Raft
+    // index; fewer if the log ends first, none if that index was
+    // compacted into a snapshot or does not exist yet. See LogEntry for
+    // how long they stay valid.
+    void read(uint64_t from, size_t max, std::vector<LogEntry> &out) const;
 
     uint64_t lastIndex() const;
     void truncateFrom(uint64_t index);
 
-    void createSnapshot(const std::string &data, uint64_t lastIndex);
-    bool loadSnapshot(std::string &data, uint64_t &index);
+    // Last index the snapshot covers; the log holds only what follows.
+    uint64_t snapshotIndex() const;
+
+    // Term of the entry at index, from the log or, at snapshotIndex(),
+    // from the snapshot. 0 for index 0; -1 if the index was compacted
+    // below the snapshot or is not in the log yet.
+    int64_t termAt(uint64_t index) const;
+
+    // Streams a snapshot to disk a chunk at a time: beginSnapshot, then
+    // writeSnapshot for each chunk, then commitSnapshot or abortSnapshot.
+    // Commit atomically replaces the previous snapshot and compacts the
+    // log up to lastIndex; only it needs the caller's log lock.
+    bool beginSnapshot();
+    bool writeSnapshot(const char *data, size_t size);
+    bool commitSnapshot(uint64_t lastIndex);
+    void abortSnapshot();
+
+    // Like commitSnapshot, but the image is a delta kept on top of the
+    // current snapshot. Fails if there is no snapshot to build on.
+    bool commitDelta(uint64_t lastIndex);
+
+    // Like commitSnapshot, for a complete image written to path, which
+    // must be in the WAL directory. The file is moved, not copied.
+    bool adoptSnapshot(const std::string &path, uint64_t lastIndex);
+
+    // File the latest full snapshot is written to, for reading it in
+    // place.
+    std::string snapshotPath() const { return file_ + "/snapshot.bin"; }
+
+    // Files making up the snapshot, in chain order: snapshotPath(), then
+    // one per delta. Empty if there is no snapshot.
+    std::vector<std::string> snapshotChain() const;
+
+    // Where a snapshot received from the leader is assembled before it
+    // is adopted.
+    std::string snapshotReceivePath() const { return file_ + "/received.bin.tmp"; }
 
 private:
     std::string file_;
-    std::vector<Operation> cache_;
 };
\ No newline at end of file
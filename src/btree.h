@@ -0,0 +1,253 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
+// Insert-only in-memory B+tree from byte-string keys to V. Keys are
+// views: the caller keeps their bytes alive as long as the tree. Leaves
+// are linked, so a range scan seeks once and then walks leaves in order.
+// Not thread-safe.
+template <typename V>
+class BPlusTree
+{
+    struct Leaf;
+
+public:
+    // Wide nodes keep the tree shallow: 64^4 covers 16M keys.
+    static constexpr int FANOUT = 64;
+
+    class Iterator
+    {
+    public:
+        bool valid() const { return leaf_ != nullptr; }
+        std::string_view key() const { return leaf_->keys[pos_]; }
+        const V &value() const { return leaf_->values[pos_]; }
+
+        void next()
+        {
+            if (++pos_ == leaf_->count)
+            {
+                leaf_ = leaf_->next;
+                pos_ = 0;
+            }
+        }
+
+    private:
+        friend class BPlusTree;
+
+        Iterator(const Leaf *leaf, int pos) : leaf_(leaf), pos_(pos)
+        {
+            // Runs off a leaf's end onto the next one; only the root can
+            // be an empty leaf.
+            if (leaf_ && pos_ == leaf_->count)
+            {
+                leaf_ = leaf_->next;
+                pos_ = 0;
+            }
+        }
+
+        const Leaf *leaf_;
+        int pos_;
+    };
+
+    BPlusTree() : root_(new Leaf), bytes_(sizeof(Leaf)) {}
+    ~BPlusTree() { destroy(root_, height_); }
+
+    BPlusTree(const BPlusTree &) = delete;
+    BPlusTree &operator=(const BPlusTree &) = delete;
+
+    // key must not already be present.
+    void insert(std::string_view key, V value)
+    {
+        std::string_view separator;
+        Node *right = insertAt(root_, height_, key, value, &separator);
+
+        if (right)
+        {
+            Inner *root = new Inner;
+            bytes_ += sizeof(Inner);
+            root->count = 2;
+            root->keys[0] = separator;
+            root->children[0] = root_;
+            root->children[1] = right;
+            root_ = root;
+            height_++;
+        }
+
+        size_++;
+    }
+
+    // First entry whose key is >= key.
+    Iterator lowerBound(std::string_view key) const
+    {
+        const Node *node = root_;
+
+        for (int level = height_; level > 0; --level)
+        {
+            const Inner *inner = static_cast<const Inner *>(node);
+            node = inner->children[childFor(inner, key)];
+        }
+
+        const Leaf *leaf = static_cast<const Leaf *>(node);
+        int pos = std::lower_bound(leaf->keys, leaf->keys + leaf->count, key) -
+                  leaf->keys;
+        return Iterator(leaf, pos);
+    }
+
+    size_t size() const { return size_; }
+    size_t memoryBytes() const { return bytes_; }
+
+private:
+    struct Node
+    {
+        int count = 0; // entries in a leaf, children in an inner node
+    };
+
+    struct Leaf : Node
+    {
+        std::string_view keys[FANOUT];
+        V values[FANOUT];
+        Leaf *next = nullptr;
+    };
+
+    // Every key under children[i + 1] is >= keys[i].
+    struct Inner : Node
+    {
+        std::string_view keys[FANOUT - 1];
+        Node *children[FANOUT];
+    };
+
+    static int childFor(const Inner *inner, std::string_view key)
+    {
+        return std::upper_bound(inner->keys, inner->keys + inner->count - 1, key) -
+               inner->keys;
+    }
+
+    // Inserts into the subtree `level` levels above the leaves. If node
+    // splits, returns its new right sibling and sets *separator to the
+    // smallest key under it.
+    Node *insertAt(Node *node, int level, std::string_view key, V value,
+                   std::string_view *separator)
+    {
+        if (level == 0)
+            return insertLeaf(static_cast<Leaf *>(node), key, value, separator);
+
+        Inner *inner = static_cast<Inner *>(node);
+        int child = childFor(inner, key);
+        std::string_view childSeparator;
+        Node *split = insertAt(inner->children[child], level - 1, key, value,
+                               &childSeparator);
+
+        if (!split)
+            return nullptr;
+
+        // Room here: the new child goes right of the one that split.
+        if (inner->count < FANOUT)
+        {
+            std::copy_backward(inner->keys + child, inner->keys + inner->count - 1,
+                               inner->keys + inner->count);
+            std::copy_backward(inner->children + child + 1,
+                               inner->children + inner->count,
+                               inner->children + inner->count + 1);
+            inner->keys[child] = childSeparator;
+            inner->children[child + 1] = split;
+            inner->count++;
+            return nullptr;
+        }
+
+        std::string_view keys[FANOUT];
+        Node *children[FANOUT + 1];
+
+        std::copy(inner->keys, inner->keys + child, keys);
+        keys[child] = childSeparator;
+        std::copy(inner->keys + child, inner->keys + FANOUT - 1, keys + child + 1);
+        std::copy(inner->children, inner->children + child + 1, children);
+        children[child + 1] = split;
+        std::copy(inner->children + child + 1, inner->children + FANOUT,
+                  children + child + 2);
+
+        // Left keeps `half` children; the key between the halves moves up.
+        const int half = (FANOUT + 1) / 2;
+        Inner *right = new Inner;
+        bytes_ += sizeof(Inner);
+
+        inner->count = half;
+        std::copy(keys, keys + half - 1, inner->keys);
+        std::copy(children, children + half, inner->children);
+
+        right->count = FANOUT + 1 - half;
+        std::copy(keys + half, keys + FANOUT, right->keys);
+        std::copy(children + half, children + FANOUT + 1, right->children);
+
+        *separator = keys[half - 1];
+        return right;
+    }
+
+    Node *insertLeaf(Leaf *leaf, std::string_view key, V value,
+                     std::string_view *separator)
+    {
+        int pos = std::lower_bound(leaf->keys, leaf->keys + leaf->count, key) -
+                  leaf->keys;
+
+        if (leaf->count < FANOUT)
+        {
+            std::copy_backward(leaf->keys + pos, leaf->keys + leaf->count,
+                               leaf->keys + leaf->count + 1);
+            std::copy_backward(leaf->values + pos, leaf->values + leaf->count,
+                               leaf->values + leaf->count + 1);
+            leaf->keys[pos] = key;
+            leaf->values[pos] = value;
+            leaf->count++;
+            return nullptr;
+        }
+
+        std::string_view keys[FANOUT + 1];
+        V values[FANOUT + 1];
+
+        std::copy(leaf->keys, leaf->keys + pos, keys);
+        keys[pos] = key;
+        std::copy(leaf->keys + pos, leaf->keys + FANOUT, keys + pos + 1);
+        std::copy(leaf->values, leaf->values + pos, values);
+        values[pos] = value;
+        std::copy(leaf->values + pos, leaf->values + FANOUT, values + pos + 1);
+
+        const int half = (FANOUT + 1) / 2;
+        Leaf *right = new Leaf;
+        bytes_ += sizeof(Leaf);
+
+        leaf->count = half;
+        std::copy(keys, keys + half, leaf->keys);
+        std::copy(values, values + half, leaf->values);
+
+        right->count = FANOUT + 1 - half;
+        std::copy(keys + half, keys + FANOUT + 1, right->keys);
+        std::copy(values + half, values + FANOUT + 1, right->values);
+
+        right->next = leaf->next;
+        leaf->next = right;
+
+        *separator = right->keys[0];
+        return right;
+    }
+
+    static void destroy(Node *node, int level)
+    {
+        if (level == 0)
+        {
+            delete static_cast<Leaf *>(node);
+            return;
+        }
+
+        Inner *inner = static_cast<Inner *>(node);
+
+        for (int i = 0; i < inner->count; ++i)
+            destroy(inner->children[i], level - 1);
+
+        delete inner;
+    }
+
+    Node *root_;
+    int height_ = 0; // levels of inner nodes above the leaves
+    size_t size_ = 0;
+    size_t bytes_;
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+struct NodeConfig
+{
+    // KVStore shards. Gets take no locks; shards split the writer locks
+    // and keep each table's growth pauses short.
+    size_t kv_shards = 16;
+
+    // Group commit: upper bound on proposals drained into one
+    // WAL append + replication round.
+    size_t max_proposal_batch = 1024;
+
+    // AppendEntries packing: a packet carries entries from the follower's
+    // nextIndex up to last_index, bounded by both caps. Keep the byte cap
+    // under gRPC's default 4MB receive limit.
+    size_t max_append_entries = 4096;
+    size_t max_append_bytes = 1024 * 1024;
+
+    // AppendEntries packets kept in flight per follower.
+    size_t max_inflight_appends = 8;
+
+    // Per-RPC deadline for replication and vote fan-out.
+    int64_t rpc_timeout_ms = 200;
+
+    // Peer channels: HTTP/2 keepalive pings and reconnect backoff.
+    int keepalive_time_ms = 10000;
+    int keepalive_timeout_ms = 2000;
+    int reconnect_backoff_min_ms = 100;
+    int reconnect_backoff_max_ms = 2000;
+
+    // How long a batch waits for a quorum before its Puts fail.
+    int64_t commit_timeout_ms = 1000;
+
+    // Pause before a follower sender retries after a failed RPC.
+    int64_t replication_retry_ms = 20;
+
+    // Identifies this node as a candidate in RequestVote. Must be unique
+    // within the cluster; main uses the listening port.
+    int64_t node_id = 0;
+
+    // Leader heartbeat period. Keep it well under the election timeout so
+    // one lost heartbeat does not trigger an election.
+    int64_t heartbeat_interval_ms = 50;
+
+    // Followers start an election after a random timeout in this range
+    // without hearing from a leader.
+    int election_timeout_min_ms = 150;
+    int election_timeout_max_ms = 300;
+
+    // A leader may serve lease reads for this long after a quorum acked
+    // a heartbeat round. Followers refuse votes for election_timeout_min_ms
+    // after hearing from a leader, so keep this below that; the gap
+    // absorbs clock drift.
+    int64_t lease_duration_ms = 120;
+
+    // How long a read may wait for the store to apply up to its index.
+    int64_t read_timeout_ms = 100;
+
+    // A background snapshot starts once the in-memory log passes either
+    // bound, and compacts the log up to the index it captured.
+    size_t snapshot_log_entries = 1000;
+    size_t snapshot_log_bytes = 64 * 1024 * 1024;
+
+    // Snapshots are streamed to disk in chunks of this size, so writing
+    // one needs this much memory rather than the size of the store.
+    size_t snapshot_chunk_bytes = 1024 * 1024;
+
+    // After the first, a snapshot writes only the keys changed since the
+    // one before (a delta). The snapshot thread merges the deltas into
+    // the full image once they add up to more than this fraction of its
+    // size, or once there are more than snapshot_max_deltas of them.
+    double snapshot_merge_ratio = 0.5;
+    size_t snapshot_max_deltas = 16;
+
+    // Threads that decode a snapshot into the store, at startup and on
+    // InstallSnapshot. 0 means one per core.
+    size_t recovery_threads = 0;
+
+    // InstallSnapshot sends the snapshot file in chunks of this size
+    // (keep it under gRPC's 4MB receive limit), optionally capped to a
+    // byte rate so catching up a follower leaves room for replication.
+    // 0 means no cap.
+    size_t snapshot_transfer_chunk_bytes = 1024 * 1024;
+    size_t snapshot_transfer_bytes_per_sec = 0;
+
+    // Deadline for a whole InstallSnapshot stream, on top of the time the
+    // byte rate cap alone needs for the chain. A follower that stops
+    // reading fails the transfer when it passes, and the sender retries.
+    int64_t snapshot_transfer_timeout_ms = 30000;
+};
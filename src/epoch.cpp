@@ -0,0 +1,104 @@
+#include "epoch.h"
+#include <functional>
+#include <thread>
+
+namespace
+{
+    size_t threadStripe()
+    {
+        thread_local size_t stripe =
+            std::hash<std::thread::id>{}(std::this_thread::get_id());
+        return stripe;
+    }
+}
+
+EpochManager::Guard::Guard(EpochManager &epochs)
+{
+    Stripe &stripe = epochs.stripes_[threadStripe() % STRIPES];
+
+    // If the epoch moved between reading it and registering, a writer
+    // may already have checked our parity and missed us: retry.
+    while (true)
+    {
+        uint64_t epoch = epochs.epoch_.load();
+        counter_ = &stripe.readers[epoch & 1];
+        counter_->fetch_add(1);
+
+        if (epochs.epoch_.load() == epoch)
+            return;
+
+        counter_->fetch_sub(1);
+    }
+}
+
+EpochManager::Guard::~Guard()
+{
+    counter_->fetch_sub(1, std::memory_order_release);
+}
+
+EpochManager::~EpochManager()
+{
+    // No readers outlive the structure they read.
+    for (auto &r : retired_)
+        r.deleter(r.ptr);
+}
+
+void EpochManager::retire(void *ptr, void (*deleter)(void *))
+{
+    bool full;
+    {
+        std::lock_guard<std::mutex> lock(retire_mutex_);
+        retired_.push_back({ptr, deleter, epoch_.load()});
+        full = retired_.size() >= RECLAIM_BATCH;
+    }
+
+    if (full)
+        reclaim();
+}
+
+bool EpochManager::tryAdvance()
+{
+    uint64_t epoch = epoch_.load();
+
+    // epoch + 1 shares a parity with epoch - 1; wait until that
+    // generation of readers has drained.
+    for (auto &stripe : stripes_)
+    {
+        if (stripe.readers[(epoch + 1) & 1].load() != 0)
+            return false;
+    }
+
+    return epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+void EpochManager::reclaim()
+{
+    // Two steps take the current epoch's retirees out of reach, if
+    // readers allow it.
+    if (tryAdvance())
+        tryAdvance();
+
+    // Readers still pinned are in the current epoch or the one before,
+    // so anything retired earlier than that is unreachable.
+    uint64_t safe = epoch_.load() - 2;
+
+    std::vector<Retired> ready;
+    {
+        std::lock_guard<std::mutex> lock(retire_mutex_);
+
+        auto keep = retired_.begin();
+
+        for (auto &r : retired_)
+        {
+            if (r.epoch <= safe)
+                ready.push_back(r);
+            else
+                *keep++ = r;
+        }
+
+        retired_.erase(keep, retired_.end());
+    }
+
+    for (auto &r : ready)
+        r.deleter(r.ptr);
+}
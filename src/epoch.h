@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Epoch-based reclamation for lock-free readers.
+//
+// Readers pin the current epoch for the length of a lookup; writers
+// retire what they unlink instead of freeing it. The global epoch only
+// advances once no reader is left in the epoch before the current one,
+// so anything retired two epochs back is unreachable and can be freed.
+// Reader counts are striped by thread so pinning does not bounce one
+// cache line between cores.
+class EpochManager
+{
+public:
+    EpochManager() = default;
+    ~EpochManager();
+
+    EpochManager(const EpochManager &) = delete;
+    EpochManager &operator=(const EpochManager &) = delete;
+
+    class Guard
+    {
+    public:
+        explicit Guard(EpochManager &epochs);
+        ~Guard();
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+    private:
+        std::atomic<int64_t> *counter_;
+    };
+
+    // Frees ptr with deleter once no pinned reader can still reach it.
+    void retire(void *ptr, void (*deleter)(void *));
+
+    template <typename T>
+    void retire(T *ptr)
+    {
+        retire(ptr, [](void *p)
+               { delete static_cast<T *>(p); });
+    }
+
+    // Advances the epoch if possible and frees what became unreachable.
+    // Never blocks on readers.
+    void reclaim();
+
+private:
+    static constexpr size_t STRIPES = 64;
+
+    // Retired items are batched before trying to advance.
+    static constexpr size_t RECLAIM_BATCH = 128;
+
+    struct alignas(64) Stripe
+    {
+        // Readers currently pinned, by epoch parity.
+        std::atomic<int64_t> readers[2] = {{0}, {0}};
+    };
+
+    struct Retired
+    {
+        void *ptr;
+        void (*deleter)(void *);
+        uint64_t epoch;
+    };
+
+    bool tryAdvance();
+
+    std::atomic<uint64_t> epoch_{2};
+    Stripe stripes_[STRIPES];
+
+    std::mutex retire_mutex_;
+    std::vector<Retired> retired_;
+};
@@ -1,942 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: kv.proto
-#ifndef GRPC_kv_2eproto__INCLUDED
-#define GRPC_kv_2eproto__INCLUDED
-
-#include "kv.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-
-namespace kv {
-
-class KVService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "kv.KVService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status Put(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::kv::PutResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::PutResponse>> AsyncPut(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::PutResponse>>(AsyncPutRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::PutResponse>> PrepareAsyncPut(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::PutResponse>>(PrepareAsyncPutRaw(context, request, cq));
-    }
-    virtual ::grpc::Status Get(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::kv::GetResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::GetResponse>> AsyncGet(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::GetResponse>>(AsyncGetRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::GetResponse>> PrepareAsyncGet(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::GetResponse>>(PrepareAsyncGetRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void Put(::grpc::ClientContext* context, const ::kv::PutRequest* request, ::kv::PutResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Put(::grpc::ClientContext* context, const ::kv::PutRequest* request, ::kv::PutResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void Get(::grpc::ClientContext* context, const ::kv::GetRequest* request, ::kv::GetResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Get(::grpc::ClientContext* context, const ::kv::GetRequest* request, ::kv::GetResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kv::PutResponse>* AsyncPutRaw(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kv::PutResponse>* PrepareAsyncPutRaw(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kv::GetResponse>* AsyncGetRaw(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kv::GetResponse>* PrepareAsyncGetRaw(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status Put(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::kv::PutResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::PutResponse>> AsyncPut(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::PutResponse>>(AsyncPutRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::PutResponse>> PrepareAsyncPut(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::PutResponse>>(PrepareAsyncPutRaw(context, request, cq));
-    }
-    ::grpc::Status Get(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::kv::GetResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::GetResponse>> AsyncGet(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::GetResponse>>(AsyncGetRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::GetResponse>> PrepareAsyncGet(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::GetResponse>>(PrepareAsyncGetRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void Put(::grpc::ClientContext* context, const ::kv::PutRequest* request, ::kv::PutResponse* response, std::function<void(::grpc::Status)>) override;
-      void Put(::grpc::ClientContext* context, const ::kv::PutRequest* request, ::kv::PutResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void Get(::grpc::ClientContext* context, const ::kv::GetRequest* request, ::kv::GetResponse* response, std::function<void(::grpc::Status)>) override;
-      void Get(::grpc::ClientContext* context, const ::kv::GetRequest* request, ::kv::GetResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::kv::PutResponse>* AsyncPutRaw(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::kv::PutResponse>* PrepareAsyncPutRaw(::grpc::ClientContext* context, const ::kv::PutRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::kv::GetResponse>* AsyncGetRaw(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::kv::GetResponse>* PrepareAsyncGetRaw(::grpc::ClientContext* context, const ::kv::GetRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_Put_;
-    const ::grpc::internal::RpcMethod rpcmethod_Get_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status Put(::grpc::ServerContext* context, const ::kv::PutRequest* request, ::kv::PutResponse* response);
-    virtual ::grpc::Status Get(::grpc::ServerContext* context, const ::kv::GetRequest* request, ::kv::GetResponse* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_Put : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_Put() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_Put() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Put(::grpc::ServerContext* /*context*/, const ::kv::PutRequest* /*request*/, ::kv::PutResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestPut(::grpc::ServerContext* context, ::kv::PutRequest* request, ::grpc::ServerAsyncResponseWriter< ::kv::PutResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_Get : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_Get() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_Get() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Get(::grpc::ServerContext* /*context*/, const ::kv::GetRequest* /*request*/, ::kv::GetResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGet(::grpc::ServerContext* context, ::kv::GetRequest* request, ::grpc::ServerAsyncResponseWriter< ::kv::GetResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_Put<WithAsyncMethod_Get<Service > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_Put : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_Put() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::kv::PutRequest, ::kv::PutResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::kv::PutRequest* request, ::kv::PutResponse* response) { return this->Put(context, request, response); }));}
-    void SetMessageAllocatorFor_Put(
-        ::grpc::MessageAllocator< ::kv::PutRequest, ::kv::PutResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::kv::PutRequest, ::kv::PutResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_Put() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Put(::grpc::ServerContext* /*context*/, const ::kv::PutRequest* /*request*/, ::kv::PutResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Put(
-      ::grpc::CallbackServerContext* /*context*/, const ::kv::PutRequest* /*request*/, ::kv::PutResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_Get : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_Get() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::kv::GetRequest, ::kv::GetResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::kv::GetRequest* request, ::kv::GetResponse* response) { return this->Get(context, request, response); }));}
-    void SetMessageAllocatorFor_Get(
-        ::grpc::MessageAllocator< ::kv::GetRequest, ::kv::GetResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::kv::GetRequest, ::kv::GetResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_Get() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Get(::grpc::ServerContext* /*context*/, const ::kv::GetRequest* /*request*/, ::kv::GetResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Get(
-      ::grpc::CallbackServerContext* /*context*/, const ::kv::GetRequest* /*request*/, ::kv::GetResponse* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_Put<WithCallbackMethod_Get<Service > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_Put : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_Put() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_Put() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Put(::grpc::ServerContext* /*context*/, const ::kv::PutRequest* /*request*/, ::kv::PutResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_Get : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_Get() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_Get() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Get(::grpc::ServerContext* /*context*/, const ::kv::GetRequest* /*request*/, ::kv::GetResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_Put : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_Put() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_Put() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Put(::grpc::ServerContext* /*context*/, const ::kv::PutRequest* /*request*/, ::kv::PutResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestPut(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_Get : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_Get() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_Get() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Get(::grpc::ServerContext* /*context*/, const ::kv::GetRequest* /*request*/, ::kv::GetResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGet(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_Put : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_Put() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Put(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_Put() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Put(::grpc::ServerContext* /*context*/, const ::kv::PutRequest* /*request*/, ::kv::PutResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Put(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_Get : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_Get() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Get(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_Get() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Get(::grpc::ServerContext* /*context*/, const ::kv::GetRequest* /*request*/, ::kv::GetResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Get(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_Put : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_Put() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::kv::PutRequest, ::kv::PutResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::kv::PutRequest, ::kv::PutResponse>* streamer) {
-                       return this->StreamedPut(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_Put() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status Put(::grpc::ServerContext* /*context*/, const ::kv::PutRequest* /*request*/, ::kv::PutResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedPut(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kv::PutRequest,::kv::PutResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_Get : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_Get() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::kv::GetRequest, ::kv::GetResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::kv::GetRequest, ::kv::GetResponse>* streamer) {
-                       return this->StreamedGet(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_Get() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status Get(::grpc::ServerContext* /*context*/, const ::kv::GetRequest* /*request*/, ::kv::GetResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGet(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kv::GetRequest,::kv::GetResponse>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_Get<Service > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_Get<Service > > StreamedService;
-};
-
-class ReplicationService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "kv.ReplicationService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status Replicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::kv::ReplicationAck* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::ReplicationAck>> AsyncReplicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::ReplicationAck>>(AsyncReplicateRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::ReplicationAck>> PrepareAsyncReplicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::ReplicationAck>>(PrepareAsyncReplicateRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientWriterInterface< ::kv::InstallSnapshotChunk>> InstallSnapshot(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response) {
-      return std::unique_ptr< ::grpc::ClientWriterInterface< ::kv::InstallSnapshotChunk>>(InstallSnapshotRaw(context, response));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::kv::InstallSnapshotChunk>> AsyncInstallSnapshot(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::kv::InstallSnapshotChunk>>(AsyncInstallSnapshotRaw(context, response, cq, tag));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::kv::InstallSnapshotChunk>> PrepareAsyncInstallSnapshot(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::kv::InstallSnapshotChunk>>(PrepareAsyncInstallSnapshotRaw(context, response, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void Replicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket* request, ::kv::ReplicationAck* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Replicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket* request, ::kv::ReplicationAck* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void InstallSnapshot(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::ClientWriteReactor< ::kv::InstallSnapshotChunk>* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kv::ReplicationAck>* AsyncReplicateRaw(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kv::ReplicationAck>* PrepareAsyncReplicateRaw(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientWriterInterface< ::kv::InstallSnapshotChunk>* InstallSnapshotRaw(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response) = 0;
-    virtual ::grpc::ClientAsyncWriterInterface< ::kv::InstallSnapshotChunk>* AsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
-    virtual ::grpc::ClientAsyncWriterInterface< ::kv::InstallSnapshotChunk>* PrepareAsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status Replicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::kv::ReplicationAck* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::ReplicationAck>> AsyncReplicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::ReplicationAck>>(AsyncReplicateRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::ReplicationAck>> PrepareAsyncReplicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::ReplicationAck>>(PrepareAsyncReplicateRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientWriter< ::kv::InstallSnapshotChunk>> InstallSnapshot(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response) {
-      return std::unique_ptr< ::grpc::ClientWriter< ::kv::InstallSnapshotChunk>>(InstallSnapshotRaw(context, response));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncWriter< ::kv::InstallSnapshotChunk>> AsyncInstallSnapshot(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) {
-      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::kv::InstallSnapshotChunk>>(AsyncInstallSnapshotRaw(context, response, cq, tag));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncWriter< ::kv::InstallSnapshotChunk>> PrepareAsyncInstallSnapshot(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::kv::InstallSnapshotChunk>>(PrepareAsyncInstallSnapshotRaw(context, response, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void Replicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket* request, ::kv::ReplicationAck* response, std::function<void(::grpc::Status)>) override;
-      void Replicate(::grpc::ClientContext* context, const ::kv::ReplicationPacket* request, ::kv::ReplicationAck* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void InstallSnapshot(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::ClientWriteReactor< ::kv::InstallSnapshotChunk>* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::kv::ReplicationAck>* AsyncReplicateRaw(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::kv::ReplicationAck>* PrepareAsyncReplicateRaw(::grpc::ClientContext* context, const ::kv::ReplicationPacket& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientWriter< ::kv::InstallSnapshotChunk>* InstallSnapshotRaw(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response) override;
-    ::grpc::ClientAsyncWriter< ::kv::InstallSnapshotChunk>* AsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq, void* tag) override;
-    ::grpc::ClientAsyncWriter< ::kv::InstallSnapshotChunk>* PrepareAsyncInstallSnapshotRaw(::grpc::ClientContext* context, ::kv::InstallSnapshotResponse* response, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_Replicate_;
-    const ::grpc::internal::RpcMethod rpcmethod_InstallSnapshot_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status Replicate(::grpc::ServerContext* context, const ::kv::ReplicationPacket* request, ::kv::ReplicationAck* response);
-    virtual ::grpc::Status InstallSnapshot(::grpc::ServerContext* context, ::grpc::ServerReader< ::kv::InstallSnapshotChunk>* reader, ::kv::InstallSnapshotResponse* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_Replicate : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_Replicate() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_Replicate() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, const ::kv::ReplicationPacket* /*request*/, ::kv::ReplicationAck* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestReplicate(::grpc::ServerContext* context, ::kv::ReplicationPacket* request, ::grpc::ServerAsyncResponseWriter< ::kv::ReplicationAck>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_InstallSnapshot : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_InstallSnapshot() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_InstallSnapshot() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::kv::InstallSnapshotChunk>* /*reader*/, ::kv::InstallSnapshotResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestInstallSnapshot(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::kv::InstallSnapshotResponse, ::kv::InstallSnapshotChunk>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncClientStreaming(1, context, reader, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_Replicate<WithAsyncMethod_InstallSnapshot<Service > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_Replicate : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_Replicate() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::kv::ReplicationPacket, ::kv::ReplicationAck>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::kv::ReplicationPacket* request, ::kv::ReplicationAck* response) { return this->Replicate(context, request, response); }));}
-    void SetMessageAllocatorFor_Replicate(
-        ::grpc::MessageAllocator< ::kv::ReplicationPacket, ::kv::ReplicationAck>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::kv::ReplicationPacket, ::kv::ReplicationAck>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_Replicate() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, const ::kv::ReplicationPacket* /*request*/, ::kv::ReplicationAck* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Replicate(
-      ::grpc::CallbackServerContext* /*context*/, const ::kv::ReplicationPacket* /*request*/, ::kv::ReplicationAck* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_InstallSnapshot : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_InstallSnapshot() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackClientStreamingHandler< ::kv::InstallSnapshotChunk, ::kv::InstallSnapshotResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, ::kv::InstallSnapshotResponse* response) { return this->InstallSnapshot(context, response); }));
-    }
-    ~WithCallbackMethod_InstallSnapshot() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::kv::InstallSnapshotChunk>* /*reader*/, ::kv::InstallSnapshotResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerReadReactor< ::kv::InstallSnapshotChunk>* InstallSnapshot(
-      ::grpc::CallbackServerContext* /*context*/, ::kv::InstallSnapshotResponse* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_Replicate<WithCallbackMethod_InstallSnapshot<Service > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_Replicate : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_Replicate() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_Replicate() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, const ::kv::ReplicationPacket* /*request*/, ::kv::ReplicationAck* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_InstallSnapshot : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_InstallSnapshot() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_InstallSnapshot() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::kv::InstallSnapshotChunk>* /*reader*/, ::kv::InstallSnapshotResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_Replicate : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_Replicate() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_Replicate() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, const ::kv::ReplicationPacket* /*request*/, ::kv::ReplicationAck* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestReplicate(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_InstallSnapshot : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_InstallSnapshot() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_InstallSnapshot() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::kv::InstallSnapshotChunk>* /*reader*/, ::kv::InstallSnapshotResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestInstallSnapshot(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncClientStreaming(1, context, reader, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_Replicate : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_Replicate() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Replicate(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_Replicate() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, const ::kv::ReplicationPacket* /*request*/, ::kv::ReplicationAck* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Replicate(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_InstallSnapshot : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_InstallSnapshot() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->InstallSnapshot(context, response); }));
-    }
-    ~WithRawCallbackMethod_InstallSnapshot() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status InstallSnapshot(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::kv::InstallSnapshotChunk>* /*reader*/, ::kv::InstallSnapshotResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* InstallSnapshot(
-      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_Replicate : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_Replicate() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::kv::ReplicationPacket, ::kv::ReplicationAck>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::kv::ReplicationPacket, ::kv::ReplicationAck>* streamer) {
-                       return this->StreamedReplicate(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_Replicate() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status Replicate(::grpc::ServerContext* /*context*/, const ::kv::ReplicationPacket* /*request*/, ::kv::ReplicationAck* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedReplicate(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kv::ReplicationPacket,::kv::ReplicationAck>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_Replicate<Service > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Replicate<Service > StreamedService;
-};
-
-class ElectionService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "kv.ElectionService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status RequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::kv::VoteResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::VoteResponse>> AsyncRequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::VoteResponse>>(AsyncRequestVoteRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::VoteResponse>> PrepareAsyncRequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kv::VoteResponse>>(PrepareAsyncRequestVoteRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void RequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest* request, ::kv::VoteResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void RequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest* request, ::kv::VoteResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kv::VoteResponse>* AsyncRequestVoteRaw(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kv::VoteResponse>* PrepareAsyncRequestVoteRaw(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status RequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::kv::VoteResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::VoteResponse>> AsyncRequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::VoteResponse>>(AsyncRequestVoteRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::VoteResponse>> PrepareAsyncRequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kv::VoteResponse>>(PrepareAsyncRequestVoteRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void RequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest* request, ::kv::VoteResponse* response, std::function<void(::grpc::Status)>) override;
-      void RequestVote(::grpc::ClientContext* context, const ::kv::VoteRequest* request, ::kv::VoteResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::kv::VoteResponse>* AsyncRequestVoteRaw(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::kv::VoteResponse>* PrepareAsyncRequestVoteRaw(::grpc::ClientContext* context, const ::kv::VoteRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_RequestVote_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status RequestVote(::grpc::ServerContext* context, const ::kv::VoteRequest* request, ::kv::VoteResponse* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_RequestVote : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_RequestVote() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_RequestVote() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RequestVote(::grpc::ServerContext* /*context*/, const ::kv::VoteRequest* /*request*/, ::kv::VoteResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestRequestVote(::grpc::ServerContext* context, ::kv::VoteRequest* request, ::grpc::ServerAsyncResponseWriter< ::kv::VoteResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_RequestVote<Service > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_RequestVote : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_RequestVote() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::kv::VoteRequest, ::kv::VoteResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::kv::VoteRequest* request, ::kv::VoteResponse* response) { return this->RequestVote(context, request, response); }));}
-    void SetMessageAllocatorFor_RequestVote(
-        ::grpc::MessageAllocator< ::kv::VoteRequest, ::kv::VoteResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::kv::VoteRequest, ::kv::VoteResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_RequestVote() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RequestVote(::grpc::ServerContext* /*context*/, const ::kv::VoteRequest* /*request*/, ::kv::VoteResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* RequestVote(
-      ::grpc::CallbackServerContext* /*context*/, const ::kv::VoteRequest* /*request*/, ::kv::VoteResponse* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_RequestVote<Service > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_RequestVote : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_RequestVote() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_RequestVote() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RequestVote(::grpc::ServerContext* /*context*/, const ::kv::VoteRequest* /*request*/, ::kv::VoteResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_RequestVote : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_RequestVote() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_RequestVote() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RequestVote(::grpc::ServerContext* /*context*/, const ::kv::VoteRequest* /*request*/, ::kv::VoteResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestRequestVote(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_RequestVote : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_RequestVote() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->RequestVote(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_RequestVote() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RequestVote(::grpc::ServerContext* /*context*/, const ::kv::VoteRequest* /*request*/, ::kv::VoteResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* RequestVote(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_RequestVote : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_RequestVote() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::kv::VoteRequest, ::kv::VoteResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::kv::VoteRequest, ::kv::VoteResponse>* streamer) {
-                       return this->StreamedRequestVote(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_RequestVote() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status RequestVote(::grpc::ServerContext* /*context*/, const ::kv::VoteRequest* /*request*/, ::kv::VoteResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedRequestVote(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kv::VoteRequest,::kv::VoteResponse>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_RequestVote<Service > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_RequestVote<Service > StreamedService;
-};
-
-}  // namespace kv
-
-
-#include <grpcpp/ports_undef.inc>
-#endif  // GRPC_kv_2eproto__INCLUDED
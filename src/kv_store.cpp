@@ -1,53 +1,872 @@
 #include "kv_store.h"
-#include <sstream>
+#include "snapshot_format.h"
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <queue>
+#include <thread>
 
-void KVStore::put(const std::string &key, const std::string &value)
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    const size_t INITIAL_CAPACITY = 64;
+    const uint64_t EMPTY_WORD = 0x8080808080808080ull;
+
+    // Bit i set for each slot i of the group whose control byte is h2.
+    inline uint32_t matchGroup(uint64_t lo, uint64_t hi, uint8_t h2)
+    {
+#ifdef __SSE2__
+        __m128i ctrl = _mm_set_epi64x((long long)hi, (long long)lo);
+        return (uint32_t)_mm_movemask_epi8(
+            _mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+#else
+        uint32_t mask = 0;
+        for (int i = 0; i < 16; ++i)
+            mask |= (uint32_t)((uint8_t)((i < 8 ? lo : hi) >> (i % 8 * 8)) == h2) << i;
+        return mask;
+#endif
+    }
+
+    // Bit i set for each empty slot; EMPTY is the only byte with the
+    // high bit set.
+    inline uint32_t matchEmpty(uint64_t lo, uint64_t hi)
+    {
+#ifdef __SSE2__
+        return (uint32_t)_mm_movemask_epi8(
+            _mm_set_epi64x((long long)hi, (long long)lo));
+#else
+        uint32_t mask = 0;
+        for (int i = 0; i < 16; ++i)
+            mask |= (uint32_t)(((i < 8 ? lo : hi) >> (i % 8 * 8 + 7)) & 1) << i;
+        return mask;
+#endif
+    }
+
+    // Low 7 bits pick the control byte; the rest pick the first group.
+    inline uint8_t h2(size_t hash) { return hash & 0x7f; }
+    inline size_t h1(size_t hash) { return hash >> 7; }
+
+    // Runs task(i) for every i below count on up to threads threads, the
+    // caller's among them, handing out indices in order.
+    template <typename Fn>
+    void parallelFor(size_t count, size_t threads, const Fn &task)
+    {
+        std::atomic<size_t> next{0};
+
+        auto worker = [&]
+        {
+            for (size_t i; (i = next++) < count;)
+                task(i);
+        };
+
+        std::vector<std::thread> pool;
+
+        for (size_t t = 1; t < std::min(threads, count); ++t)
+            pool.emplace_back(worker);
+
+        worker();
+
+        for (auto &thread : pool)
+            thread.join();
+    }
+}
+
+KVStore::Entry *KVStore::Entry::create(size_t hash,
+                                       const char *key,
+                                       size_t size,
+                                       ValueBuffer *value)
+{
+    void *mem = SlabAllocator::global().allocate(sizeof(Entry) + size);
+    Entry *entry = new (mem) Entry{hash, {value}, (uint32_t)size};
+    std::memcpy(const_cast<char *>(entry->key()), key, size);
+    return entry;
+}
+
+void KVStore::Entry::destroy(Entry *entry)
+{
+    size_t bytes = sizeof(Entry) + entry->key_size;
+    entry->~Entry();
+    SlabAllocator::global().deallocate(entry, bytes);
+}
+
+KVStore::Table::Table(size_t capacity)
+    : group_mask(capacity / GROUP - 1),
+      ctrl(new std::atomic<uint64_t>[capacity / 8]),
+      slots(new std::atomic<Entry *>[capacity])
+{
+    for (size_t i = 0; i < capacity / 8; ++i)
+        ctrl[i].store(EMPTY_WORD, std::memory_order_relaxed);
+
+    for (size_t i = 0; i < capacity; ++i)
+        slots[i].store(nullptr, std::memory_order_relaxed);
+}
+
+KVStore::Table::~Table()
+{
+    if (!owns_entries)
+        return;
+
+    for (size_t i = 0; i < capacity(); ++i)
+    {
+        Entry *entry = slots[i].load(std::memory_order_relaxed);
+
+        if (entry)
+        {
+            entry->value.load(std::memory_order_relaxed)->unref();
+            Entry::destroy(entry);
+        }
+    }
+}
+
+KVStore::Entry *KVStore::Table::find(size_t hash, std::string_view key) const
+{
+    // Triangular probing over groups visits every group once when the
+    // group count is a power of two.
+    size_t group = h1(hash) & group_mask;
+
+    for (size_t step = 1; ; ++step)
+    {
+        uint64_t lo = ctrl[group * 2].load(std::memory_order_acquire);
+        uint64_t hi = ctrl[group * 2 + 1].load(std::memory_order_acquire);
+
+        for (uint32_t m = matchGroup(lo, hi, h2(hash)); m; m &= m - 1)
+        {
+            Entry *entry = slots[group * GROUP + __builtin_ctz(m)].load();
+
+            if (entry && entry->matches(hash, key))
+                return entry;
+        }
+
+        if (matchEmpty(lo, hi))
+            return nullptr;
+
+        group = (group + step) & group_mask;
+    }
+}
+
+void KVStore::Table::insert(Entry *entry)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    store_[key] = value;
+    size_t group = h1(entry->hash) & group_mask;
+
+    for (size_t step = 1; ; ++step)
+    {
+        uint64_t lo = ctrl[group * 2].load(std::memory_order_relaxed);
+        uint64_t hi = ctrl[group * 2 + 1].load(std::memory_order_relaxed);
+
+        if (uint32_t m = matchEmpty(lo, hi))
+        {
+            size_t slot = group * GROUP + __builtin_ctz(m);
+            std::atomic<uint64_t> &word = ctrl[slot / 8];
+            int shift = slot % 8 * 8;
+
+            // Entry first, then the control byte that makes it findable.
+            // Only the writer changes control words, so a plain
+            // read-modify-store is enough.
+            slots[slot].store(entry, std::memory_order_relaxed);
+            word.store((word.load(std::memory_order_relaxed) & ~(0xffull << shift)) |
+                           ((uint64_t)h2(entry->hash) << shift),
+                       std::memory_order_release);
+            count++;
+            return;
+        }
+
+        group = (group + step) & group_mask;
+    }
+}
+
+KVStore::KVStore(size_t shards)
+    : ordered_(std::make_unique<BPlusTree<Entry *>>())
+{
+    if (shards == 0)
+        shards = 1;
+
+    for (size_t i = 0; i < shards; ++i)
+    {
+        shards_.push_back(std::make_unique<Shard>());
+        shards_.back()->table = newTable(INITIAL_CAPACITY);
+    }
+}
+
+KVStore::~KVStore()
+{
+    for (auto &shard : shards_)
+        delete shard->table.load();
+}
+
+KVStore::Table *KVStore::newTable(size_t capacity)
+{
+    index_bytes_ += capacity * (1 + sizeof(std::atomic<Entry *>));
+    return new Table(capacity);
+}
+
+void KVStore::dropTable(Table *table, bool published)
+{
+    index_bytes_ -= table->capacity() * (1 + sizeof(std::atomic<Entry *>));
+
+    // Retired slot arrays are as big as the live ones; don't let them
+    // wait for a full retire batch.
+    if (published)
+    {
+        epochs_.retire(table);
+        epochs_.reclaim();
+    }
+    else
+        delete table;
 }
 
-bool KVStore::get(const std::string &key, std::string &value)
+KVStore::MemoryStats KVStore::memoryStats() const
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = store_.find(key);
-    if (it == store_.end())
+    SlabAllocator::Stats slabs = SlabAllocator::global().stats();
+    size_t ordered;
+
+    {
+        std::shared_lock<std::shared_mutex> lock(ordered_mutex_);
+        ordered = ordered_->memoryBytes();
+    }
+
+    return {keys_.load(),
+            logical_bytes_.load(),
+            index_bytes_.load() + ordered,
+            slabs.reserved_bytes,
+            slabs.used_bytes};
+}
+
+size_t KVStore::shardIndex(size_t hash) const
+{
+    // Tables use the low bits of the hash, so pick the shard from the
+    // high bits.
+    return (hash >> 32) % shards_.size();
+}
+
+bool KVStore::needsGrowth(const Table *table)
+{
+    return (table->count + 1) * 8 > table->capacity() * 7;
+}
+
+KVStore::Table *KVStore::grown(Table *table)
+{
+    Table *bigger = newTable(table->capacity() * 2);
+
+    for (size_t i = 0; i < table->capacity(); ++i)
+    {
+        if (Entry *entry = table->slots[i].load())
+            bigger->insert(entry);
+    }
+
+    table->owns_entries = false;
+    return bigger;
+}
+
+void KVStore::put(std::string_view key, std::string_view value)
+{
+    size_t hash = std::hash<std::string_view>{}(key);
+    Shard &shard = *shards_[shardIndex(hash)];
+
+    std::lock_guard<std::mutex> lock(shard.write_mutex);
+    putLocked(shard, hash, key, value);
+}
+
+void KVStore::put(const std::vector<std::pair<std::string_view, std::string_view>> &entries)
+{
+    std::vector<size_t> hashes;
+    std::vector<size_t> order;
+    hashes.reserve(entries.size());
+    order.reserve(entries.size());
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        hashes.push_back(std::hash<std::string_view>{}(entries[i].first));
+        order.push_back(i);
+    }
+
+    // Group by shard; stable, so repeated writes to a key keep their order.
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+                     { return shardIndex(hashes[a]) < shardIndex(hashes[b]); });
+
+    for (size_t i = 0; i < order.size();)
+    {
+        size_t index = shardIndex(hashes[order[i]]);
+        Shard &shard = *shards_[index];
+
+        std::lock_guard<std::mutex> lock(shard.write_mutex);
+
+        for (; i < order.size() && shardIndex(hashes[order[i]]) == index; ++i)
+        {
+            const auto &[key, value] = entries[order[i]];
+            putLocked(shard, hashes[order[i]], key, value);
+        }
+    }
+}
+
+void KVStore::putLocked(Shard &shard, size_t hash,
+                        std::string_view key, std::string_view value)
+{
+    Table *table = shard.table.load();
+
+    if (Entry *entry = table->find(hash, key))
+    {
+        ValueBuffer *current = entry->value.load();
+        preserve(entry, current);
+        markDirty(shard, entry, current);
+
+        // A reader may have loaded the old pointer but not yet taken its
+        // own reference, so drop ours only once it is unreachable.
+        ValueBuffer *old = entry->value.exchange(
+            ValueBuffer::create(value.data(), value.size(), ++write_version_));
+        logical_bytes_ += value.size();
+        logical_bytes_ -= old->size();
+        epochs_.retire(old, [](void *p)
+                       { static_cast<ValueBuffer *>(p)->unref(); });
+        return;
+    }
+
+    // Readers may still be probing the old table, so retire it rather
+    // than freeing it.
+    if (needsGrowth(table))
+    {
+        Table *bigger = grown(table);
+        shard.table.store(bigger);
+        dropTable(table, true);
+        table = bigger;
+    }
+
+    Entry *entry = Entry::create(hash, key.data(), key.size(),
+                                 ValueBuffer::create(value.data(), value.size(), ++write_version_));
+    table->insert(entry);
+    shard.dirty.push_back(entry);
+
+    {
+        std::unique_lock<std::shared_mutex> ordered(ordered_mutex_);
+        ordered_->insert(std::string_view(entry->key(), entry->key_size), entry);
+    }
+
+    keys_++;
+    logical_bytes_ += key.size() + value.size();
+}
+
+bool KVStore::get(const std::string &key, ValueRef &value)
+{
+    size_t hash = std::hash<std::string>{}(key);
+    const Shard &shard = *shards_[shardIndex(hash)];
+
+    EpochManager::Guard guard(epochs_);
+
+    const Entry *entry = shard.table.load()->find(hash, key);
+
+    if (!entry)
         return false;
 
-    value = it->second;
+    // The epoch keeps the buffer alive until we hold our own reference.
+    ValueBuffer *buffer = entry->value.load();
+    buffer->ref();
+    value = ValueRef(buffer);
     return true;
 }
 
-std::string KVStore::serialize() const
+void KVStore::multiGet(const std::vector<std::string> &keys,
+                       std::vector<ValueRef> &values) const
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<const Table *> tables(shards_.size(), nullptr);
+
+    values.clear();
+    values.resize(keys.size());
 
-    std::string out;
-    for (const auto &kv : store_)
+    EpochManager::Guard guard(epochs_);
+
+    for (size_t i = 0; i < keys.size(); ++i)
     {
-        out += kv.first;
-        out.push_back('=');
-        out += kv.second;
-        out.push_back('\n');
+        size_t hash = std::hash<std::string>{}(keys[i]);
+        size_t index = shardIndex(hash);
+
+        if (!tables[index])
+            tables[index] = shards_[index]->table.load();
+
+        if (const Entry *entry = tables[index]->find(hash, keys[i]))
+        {
+            ValueBuffer *buffer = entry->value.load();
+            buffer->ref();
+            values[i] = ValueRef(buffer);
+        }
     }
-    return out;
 }
 
-void KVStore::deserialize(const std::string &data)
+void KVStore::scan(const std::string &start,
+                   const std::string &end,
+                   size_t limit,
+                   std::vector<std::pair<std::string, ValueRef>> &out) const
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    // The guard keeps values a writer replaces mid-scan alive until we
+    // hold our own references.
+    EpochManager::Guard guard(epochs_);
+    std::shared_lock<std::shared_mutex> lock(ordered_mutex_);
 
-    store_.clear();
+    for (auto it = ordered_->lowerBound(start); it.valid() && limit > 0;
+         it.next(), --limit)
+    {
+        if (!end.empty() && it.key() >= end)
+            break;
 
-    std::stringstream ss(data);
-    std::string line;
+        ValueBuffer *buffer = it.value()->value.load();
+        buffer->ref();
+        out.emplace_back(std::string(it.key()), ValueRef(buffer));
+    }
+}
 
-    while (std::getline(ss, line))
+void KVStore::markDirty(Shard &shard, const Entry *entry,
+                        const ValueBuffer *current)
+{
+    if (current->version() <= dirty_since_)
+        shard.dirty.push_back(entry);
+}
+
+void KVStore::preserve(const Entry *entry, ValueBuffer *current)
+{
+    Frozen *frozen = frozen_.load();
+
+    // A value newer than the view means this key was already overwritten
+    // since the snapshot, and the view's value is preserved.
+    if (!frozen || current->version() > frozen->version)
+        return;
+
+    current->ref();
+
+    std::lock_guard<std::mutex> lock(frozen->mutex);
+    frozen->preserved.emplace(entry, ValueRef(current));
+}
+
+std::unique_ptr<KVStore::Snapshot> KVStore::snapshot(bool delta)
+{
+    auto frozen = std::make_unique<Frozen>();
+
+    // With every writer lock held no put is half done: each value at or
+    // below the version is in place, and every later put sees frozen_.
+    std::vector<std::unique_lock<std::mutex>> writers;
+
+    for (auto &shard : shards_)
+        writers.emplace_back(shard->write_mutex);
+
+    if (frozen_.load())
+        return nullptr;
+
+    frozen->version = write_version_.load();
+    frozen->keys = keys_.load();
+    frozen->logical_bytes = logical_bytes_.load();
+    frozen->delta = delta;
+
+    // Hand the dirty lists over rather than walking them, so writers
+    // wait only for the swaps. Whatever the view's kind, tracking starts
+    // again from here.
+    for (auto &shard : shards_)
+    {
+        frozen->dirty.emplace_back();
+
+        if (delta)
+            frozen->dirty.back().swap(shard->dirty);
+        else
+            shard->dirty.clear();
+    }
+
+    dirty_since_ = frozen->version;
+    frozen_.store(frozen.get());
+
+    return std::unique_ptr<Snapshot>(new Snapshot(this, frozen.release()));
+}
+
+KVStore::Snapshot::~Snapshot()
+{
+    // Writers only touch frozen_ under their shard's lock.
+    {
+        std::vector<std::unique_lock<std::mutex>> writers;
+
+        for (auto &shard : store_->shards_)
+            writers.emplace_back(shard->write_mutex);
+
+        store_->frozen_.store(nullptr);
+    }
+
+    delete frozen_;
+}
+
+bool KVStore::Snapshot::delta() const
+{
+    return frozen_->delta;
+}
+
+bool KVStore::Snapshot::viewValue(const Entry *entry,
+                                  const char *&data, size_t &size) const
+{
+    const ValueBuffer *value = entry->value.load();
+    data = value->data();
+    size = value->size();
+
+    if (value->version() <= frozen_->version)
+        return true;
+
+    // Overwritten since the view was taken (its value was preserved
+    // first), or inserted since.
+    std::lock_guard<std::mutex> lock(frozen_->mutex);
+    auto it = frozen_->preserved.find(entry);
+
+    if (it == frozen_->preserved.end())
+        return false;
+
+    data = it->second.data();
+    size = it->second.size();
+    return true;
+}
+
+bool KVStore::Snapshot::write(uint64_t lastIndex, uint64_t lastTerm,
+                              size_t chunkBytes, const Sink &sink) const
+{
+    namespace fmt = snapshot_format;
+
+    fmt::Header header;
+    header.delta = frozen_->delta;
+    header.last_index = lastIndex;
+    header.last_term = lastTerm;
+
+    // A full view's size was fixed when it was taken. A delta's is summed
+    // over its keys first; their view values cannot change, so both
+    // passes agree. Either way the header goes out first and the image
+    // never has to be held whole.
+    if (!frozen_->delta)
+    {
+        header.records = frozen_->keys;
+        header.data_bytes = frozen_->keys * fmt::RECORD_HEADER_BYTES +
+                            frozen_->logical_bytes;
+    }
+
+    for (const auto &entries : frozen_->dirty)
+    {
+        EpochManager::Guard guard(store_->epochs_);
+
+        for (const Entry *entry : entries)
+        {
+            const char *data;
+            size_t size;
+
+            if (!viewValue(entry, data, size))
+                continue;
+
+            header.records++;
+            header.data_bytes += fmt::RECORD_HEADER_BYTES + entry->key_size + size;
+        }
+    }
+
+    // A section per shard, so loading can split the image by thread.
+    uint64_t recordBytes = header.data_bytes;
+    std::vector<uint64_t> offsets;
+
+    header.sections = (uint32_t)store_->shards_.size();
+    header.data_bytes += fmt::sectionTableBytes(header.sections);
+
+    fmt::ChunkWriter out(chunkBytes, sink);
+    char head[fmt::HEADER_BYTES];
+    fmt::encodeHeader(header, head);
+
+    if (!out.append(head, sizeof(head)))
+        return false;
+
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+
+    auto append = [&](const Entry *entry)
+    {
+        const char *data;
+        size_t size;
+
+        if (!viewValue(entry, data, size))
+            return true;
+
+        char lengths[fmt::RECORD_HEADER_BYTES];
+        fmt::putU32(lengths, entry->key_size);
+        fmt::putU32(lengths + 4, (uint32_t)size);
+
+        records++;
+        bytes += sizeof(lengths) + entry->key_size + size;
+
+        return out.append(lengths, sizeof(lengths)) &&
+               out.append(entry->key(), entry->key_size) &&
+               out.append(data, size);
+    };
+
+    if (frozen_->delta)
+    {
+        for (const auto &entries : frozen_->dirty)
+        {
+            EpochManager::Guard guard(store_->epochs_);
+            offsets.push_back(bytes);
+
+            for (const Entry *entry : entries)
+            {
+                if (!append(entry))
+                    return false;
+            }
+        }
+    }
+    else
+    {
+        for (const auto &shard : store_->shards_)
+        {
+            // Pinned per shard: keeps this shard's slot arrays valid for
+            // the walk without holding up reclamation for the whole
+            // snapshot.
+            EpochManager::Guard guard(store_->epochs_);
+            offsets.push_back(bytes);
+
+            const Table *table = shard->table.load();
+
+            for (size_t i = 0; i < table->capacity(); ++i)
+            {
+                const Entry *entry = table->slots[i].load();
+
+                if (entry && !append(entry))
+                    return false;
+            }
+        }
+    }
+
+    // The header promised these; a mismatch would be a bookkeeping bug,
+    // and the image is not sent on with a valid checksum.
+    std::string table = fmt::encodeSections(offsets);
+
+    if (records != header.records || bytes != recordBytes ||
+        !out.append(table.data(), table.size()) || !out.flush())
+        return false;
+
+    char crc[fmt::TRAILER_BYTES];
+    fmt::putU32(crc, out.crc());
+    return out.append(crc, sizeof(crc)) && out.flush();
+}
+
+bool KVStore::deserialize(const char *data, size_t size)
+{
+    snapshot_format::Image image{data, size, {}};
+
+    if (!snapshot_format::decodeHeader(data, size, image.header))
+        return false;
+
+    return deserialize(std::vector<snapshot_format::Image>{image});
+}
+
+bool KVStore::deserialize(const std::vector<snapshot_format::Image> &chain,
+                          size_t threads)
+{
+    namespace fmt = snapshot_format;
+
+    // A record as located in the image, tagged with its key's hash.
+    struct Located
     {
-        auto pos = line.find('=');
-        if (pos == std::string::npos)
-            continue;
+        size_t hash;
+        const char *record;
+    };
+
+    if (!fmt::isChain(chain))
+        return false;
+
+    std::vector<fmt::Section> sections;
+    uint64_t total = 0;
 
-        store_[line.substr(0, pos)] = line.substr(pos + 1);
+    for (const fmt::Image &image : chain)
+    {
+        if (!fmt::sections(image, sections))
+            return false;
+
+        total += image.header.records;
     }
-}
\ No newline at end of file
+
+    // Phase 1, by section: walk the records and sort them by shard.
+    // Checksums are verified alongside, as tasks of their own, and
+    // nothing is allocated for the store until every one has passed.
+    size_t shardCount = shards_.size();
+    std::vector<std::vector<Located>> located(sections.size() * shardCount);
+    std::vector<uint64_t> counts(sections.size(), 0);
+    std::atomic<bool> valid{true};
+
+    parallelFor(chain.size() + sections.size(), threads, [&](size_t task)
+                {
+        if (task < chain.size())
+        {
+            if (!fmt::verifyChecksum(chain[task].data, chain[task].size))
+                valid = false;
+            return;
+        }
+
+        size_t section = task - chain.size();
+        const char *p = sections[section].begin;
+        const char *end = sections[section].end;
+
+        while ((size_t)(end - p) >= fmt::RECORD_HEADER_BYTES)
+        {
+            size_t keySize = fmt::getU32(p);
+            size_t valueSize = fmt::getU32(p + 4);
+
+            if ((size_t)(end - p) - fmt::RECORD_HEADER_BYTES < keySize + valueSize)
+                break;
+
+            std::string_view key(p + fmt::RECORD_HEADER_BYTES, keySize);
+            size_t hash = std::hash<std::string_view>{}(key);
+
+            located[section * shardCount + shardIndex(hash)].push_back({hash, p});
+            counts[section]++;
+            p += fmt::RECORD_HEADER_BYTES + keySize + valueSize;
+        }
+
+        if (p != end)
+            valid = false; });
+
+    uint64_t records = 0;
+
+    for (uint64_t count : counts)
+        records += count;
+
+    // A checksum match with records that don't add up means a writer bug,
+    // not a torn file; either way nothing has been built yet.
+    if (!valid || records != total)
+        return false;
+
+    // Size every table for its share of the records up front, with room
+    // for uneven shards, so loading rarely stops to grow one. Deltas
+    // mostly rewrite keys the full image has, so this errs large.
+    size_t perShard = total / shardCount + 1;
+    size_t capacity = INITIAL_CAPACITY;
+
+    while (perShard * 4 > capacity * 3)
+        capacity *= 2;
+
+    // No view is alive, so every loaded value can share one version.
+    uint64_t version = ++write_version_;
+
+    std::vector<Table *> tables(shardCount);
+    std::vector<std::vector<Entry *>> entries(shardCount);
+    std::vector<size_t> keys(shardCount, 0);
+    std::vector<size_t> logical(shardCount, 0);
+
+    // Phase 2, by shard: build each table off to the side, where no
+    // reader can see it. Sections are taken in chain order, so a delta's
+    // records overwrite the values before them. Each shard's keys are
+    // then sorted for the ordered index.
+    parallelFor(shardCount, threads, [&](size_t shard)
+                {
+        Table *table = newTable(capacity);
+
+        for (size_t section = 0; section < sections.size(); ++section)
+        {
+            std::vector<Located> &run = located[section * shardCount + shard];
+
+            for (const Located &rec : run)
+            {
+                size_t keySize = fmt::getU32(rec.record);
+                size_t valueSize = fmt::getU32(rec.record + 4);
+                const char *key = rec.record + fmt::RECORD_HEADER_BYTES;
+
+                ValueBuffer *value = ValueBuffer::create(key + keySize, valueSize,
+                                                         version);
+                logical[shard] += valueSize;
+
+                if (Entry *entry = table->find(rec.hash, std::string_view(key, keySize)))
+                {
+                    ValueBuffer *old = entry->value.exchange(value);
+                    logical[shard] -= old->size();
+                    old->unref();
+                    continue;
+                }
+
+                if (needsGrowth(table))
+                {
+                    Table *bigger = grown(table);
+                    dropTable(table, false);
+                    table = bigger;
+                }
+
+                Entry *entry = Entry::create(rec.hash, key, keySize, value);
+                table->insert(entry);
+                entries[shard].push_back(entry);
+                keys[shard]++;
+                logical[shard] += keySize;
+            }
+
+            std::vector<Located>().swap(run);
+        }
+
+        std::sort(entries[shard].begin(), entries[shard].end(),
+                  [](const Entry *a, const Entry *b)
+                  { return std::string_view(a->key(), a->key_size) <
+                           std::string_view(b->key(), b->key_size); });
+
+        tables[shard] = table; });
+
+    // Phase 3: merge the shards' sorted keys into the ordered index. In
+    // key order, each insert lands on the rightmost leaf, which stays in
+    // cache.
+    auto keyOf = [](const Entry *entry)
+    { return std::string_view(entry->key(), entry->key_size); };
+
+    // (shard, position) of each shard's next key; the smallest on top.
+    using Cursor = std::pair<size_t, size_t>;
+    auto after = [&](const Cursor &a, const Cursor &b)
+    { return keyOf(entries[a.first][a.second]) > keyOf(entries[b.first][b.second]); };
+    std::priority_queue<Cursor, std::vector<Cursor>, decltype(after)> next(after);
+
+    for (size_t shard = 0; shard < shardCount; ++shard)
+    {
+        if (!entries[shard].empty())
+            next.push({shard, 0});
+    }
+
+    auto ordered = std::make_unique<BPlusTree<Entry *>>();
+
+    while (!next.empty())
+    {
+        auto [shard, pos] = next.top();
+        next.pop();
+
+        Entry *entry = entries[shard][pos];
+        ordered->insert(keyOf(entry), entry);
+
+        if (pos + 1 < entries[shard].size())
+            next.push({shard, pos + 1});
+    }
+
+    // Hold every writer lock so no put lands in a table or index that is
+    // being replaced, and switch the index before retiring the old
+    // entries so no new scan can reach them.
+    std::vector<std::unique_lock<std::mutex>> writers;
+
+    for (auto &shard : shards_)
+        writers.emplace_back(shard->write_mutex);
+
+    for (size_t i = 0; i < shards_.size(); ++i)
+        tables[i] = shards_[i]->table.exchange(tables[i]);
+
+    {
+        std::unique_lock<std::shared_mutex> lock(ordered_mutex_);
+        ordered_.swap(ordered);
+    }
+
+    // The dirty lists point at the old entries, and the loaded ones are
+    // all on disk already.
+    for (auto &shard : shards_)
+        shard->dirty.clear();
+
+    dirty_since_ = write_version_.load();
+
+    for (Table *old : tables)
+        dropTable(old, true);
+
+    size_t totalKeys = 0;
+    size_t totalLogical = 0;
+
+    for (size_t shard = 0; shard < shardCount; ++shard)
+    {
+        totalKeys += keys[shard];
+        totalLogical += logical[shard];
+    }
+
+    keys_ = totalKeys;
+    logical_bytes_ = totalLogical;
+    return true;
+}
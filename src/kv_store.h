@@ -1,19 +1,265 @@
 #pragma once
-#include <unordered_map>
+#include "btree.h"
+#include "epoch.h"
+#include "snapshot_format.h"
+#include "value_buffer.h"
+#include <atomic>
+#include <cstring>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <memory>
 
+// Keys are spread over shards by hash. Readers take no locks: each shard
+// is an insert-only open-addressing table whose slots and value pointers
+// are published atomically, and whatever a writer replaces (a value, or
+// the slot arrays on growth) is freed through epoch reclamation once no
+// reader can still see it. Writers serialize
+// per shard. Values are immutable ref-counted buffers, so a reader can
+// keep one after its lookup without copying it. Entries (with their keys
+// inline) and values come from size-class slabs, so an insert costs two
+// slab allocations and no heap calls. A B+tree over the same entries,
+// behind its own reader-writer lock, serves range scans; only inserts of
+// new keys touch it. Each shard lists the keys written since the last
+// snapshot view, so a delta snapshot visits only those.
 class KVStore
 {
+    struct Entry;
+    struct Frozen;
+
 public:
-    void put(const std::string &key, const std::string &value);
-    bool get(const std::string &key, std::string &value);
+    struct MemoryStats
+    {
+        size_t keys;
+        size_t logical_bytes;       // key and value bytes stored
+        size_t index_bytes;         // hash tables and ordered index
+        size_t slab_reserved_bytes; // process-wide slab footprint
+        size_t slab_used_bytes;     // blocks in use, at class size
+    };
+
+    explicit KVStore(size_t shards = 16);
+    ~KVStore();
+
+    void put(std::string_view key, std::string_view value);
+
+    // Zero-copy lookup: value shares the stored buffer.
+    bool get(const std::string &key, ValueRef &value);
+
+    // Writes entries in order, taking each shard's writer lock once.
+    void put(const std::vector<std::pair<std::string_view, std::string_view>> &entries);
+
+    // values[i] shares the buffer for keys[i], or is null if the key is
+    // absent. Pins the epoch and loads each shard's table once for the
+    // whole batch.
+    void multiGet(const std::vector<std::string> &keys,
+                  std::vector<ValueRef> &values) const;
+
+    // Appends entries with start <= key < end (no upper bound if end is
+    // empty) in key order, at most limit of them. Values share the stored
+    // buffers. Holds the ordered index's read lock throughout, so page
+    // through big ranges rather than asking for them at once.
+    void scan(const std::string &start,
+              const std::string &end,
+              size_t limit,
+              std::vector<std::pair<std::string, ValueRef>> &out) const;
+
+    size_t shardCount() const { return shards_.size(); }
+
+    MemoryStats memoryStats() const;
+
+    // Point-in-time view of the store, for snapshots taken in the
+    // background. While one is alive, the first overwrite of each key
+    // hands the value the view needs to the view (copy-on-write), so
+    // writers never wait for it to be serialized.
+    class Snapshot
+    {
+    public:
+        ~Snapshot();
+
+        using Sink = snapshot_format::Sink;
 
-    // Snapshot support
-    std::string serialize() const;
-    void deserialize(const std::string &data);
+        // Streams the view as a snapshot_format image stamped with the
+        // given log position, in chunks of about chunkBytes: every key
+        // and value, or for a delta view only the keys written since the
+        // view before it. Memory use is one chunk however big the store.
+        // Returns false if sink did.
+        bool write(uint64_t lastIndex, uint64_t lastTerm,
+                   size_t chunkBytes, const Sink &sink) const;
+
+        bool delta() const;
+
+    private:
+        friend class KVStore;
+        Snapshot(KVStore *store, Frozen *frozen)
+            : store_(store), frozen_(frozen) {}
+
+        // The entry's value as of the view, or false if it was inserted
+        // since. Caller pins the epoch.
+        bool viewValue(const Entry *entry, const char *&data, size_t &size) const;
+
+        KVStore *store_;
+        Frozen *frozen_;
+    };
+
+    // Takes each shard's writer lock once; everything applied before the
+    // call is in the view and nothing after it. A delta view holds just
+    // the keys written since the previous view, of either kind. Every
+    // view starts tracking afresh, so if a delta is never written the
+    // next snapshot must be full. Returns nullptr if a view is already
+    // alive.
+    std::unique_ptr<Snapshot> snapshot(bool delta = false);
+
+    // Replaces the whole store with a snapshot_format chain (a full image
+    // and its deltas), reading it in place (it may be mapped files).
+    // Sections are decoded and shards built on up to threads threads.
+    // Returns false, leaving the store as it was, if an image is
+    // truncated, out of order or fails its checksum. Must not run while a
+    // Snapshot is alive.
+    bool deserialize(const std::vector<snapshot_format::Image> &chain,
+                     size_t threads = 1);
+    bool deserialize(const char *data, size_t size);
+    bool deserialize(const std::string &data)
+    {
+        return deserialize(data.data(), data.size());
+    }
 
 private:
-    std::unordered_map<std::string, std::string> store_;
-    mutable std::mutex mutex_;
-};
\ No newline at end of file
+    // One slab block: this header, then the key bytes, so comparing a
+    // short key touches a single cache line.
+    struct Entry
+    {
+        size_t hash;
+        std::atomic<ValueBuffer *> value; // holds one reference
+        uint32_t key_size;
+
+        const char *key() const { return reinterpret_cast<const char *>(this + 1); }
+
+        bool matches(size_t h, std::string_view k) const
+        {
+            return hash == h && key_size == k.size() &&
+                   std::memcmp(key(), k.data(), k.size()) == 0;
+        }
+
+        static Entry *create(size_t hash, const char *key, size_t size,
+                             ValueBuffer *value);
+        static void destroy(Entry *entry);
+    };
+
+    // Swiss-table style open addressing. Slots are probed a group of 16
+    // at a time: each slot has a control byte holding 7 bits of its
+    // entry's hash (or EMPTY), and a whole group is matched with one SIMD
+    // compare before any entry is touched. There are no deletes, so an
+    // empty slot ends a probe. Control bytes are kept in atomic 64-bit
+    // words so readers can load a group while the writer fills it; the
+    // writer stores the slot's entry before publishing its control byte.
+    struct Table
+    {
+        static constexpr size_t GROUP = 16;
+        static constexpr uint8_t EMPTY = 0x80;
+
+        explicit Table(size_t capacity);
+        ~Table();
+
+        size_t capacity() const { return group_mask * GROUP + GROUP; }
+
+        // Slot holding key's entry, or nullptr.
+        Entry *find(size_t hash, std::string_view key) const;
+
+        // Puts entry in the first empty slot on its probe sequence.
+        void insert(Entry *entry);
+
+        size_t group_mask;
+        size_t count = 0;
+        std::unique_ptr<std::atomic<uint64_t>[]> ctrl;
+        std::unique_ptr<std::atomic<Entry *>[]> slots;
+
+        // Cleared when a grown table takes over the entries.
+        bool owns_entries = true;
+    };
+
+    // Padded to a cache line so neighbouring shards don't share one.
+    struct alignas(64) Shard
+    {
+        std::mutex write_mutex;
+        std::atomic<Table *> table;
+
+        // Entries written since the last view, each once. Guarded by
+        // write_mutex.
+        std::vector<const Entry *> dirty;
+    };
+
+    size_t shardIndex(size_t hash) const;
+
+    // Caller holds shard.write_mutex.
+    void putLocked(Shard &shard, size_t hash,
+                   std::string_view key, std::string_view value);
+
+    // Lists entry as dirty unless its current value, replaced by this
+    // write, was already written since the last view. Caller holds the
+    // shard's writer lock.
+    void markDirty(Shard &shard, const Entry *entry, const ValueBuffer *current);
+
+    // Before a writer replaces an entry's value: hands it to the live
+    // Snapshot if the view still needs it. Caller holds the shard's
+    // writer lock.
+    void preserve(const Entry *entry, ValueBuffer *current);
+
+    Table *newTable(size_t capacity);
+
+    // A table with twice the capacity holding the same entries. It takes
+    // them over; the caller frees or retires the original.
+    Table *grown(Table *table);
+
+    // Whether one more entry would take table past 7/8 full.
+    static bool needsGrowth(const Table *table);
+
+    // Frees table now, or once readers are done with it if published.
+    void dropTable(Table *table, bool published);
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    // Every entry, by key. Taken after a shard's write_mutex.
+    mutable std::shared_mutex ordered_mutex_;
+    std::unique_ptr<BPlusTree<Entry *>> ordered_;
+
+    mutable EpochManager epochs_;
+
+    // State of a live Snapshot, shared with the writers.
+    struct Frozen
+    {
+        uint64_t version; // values at or below this are in the view
+
+        // The view's size, for the image header. Full views only.
+        size_t keys;
+        size_t logical_bytes;
+
+        // A delta view's keys, per shard. Entries outlive the view, as
+        // the store cannot be replaced while one is alive.
+        bool delta;
+        std::vector<std::vector<const Entry *>> dirty;
+
+        std::mutex mutex;
+        std::unordered_map<const Entry *, ValueRef> preserved;
+    };
+
+    // Stamped on every value written; orders writes against snapshots.
+    std::atomic<uint64_t> write_version_{0};
+
+    // Version of the last view. A value above it was written since, so
+    // its key is on a dirty list already. Changed only with every shard's
+    // writer lock held.
+    uint64_t dirty_since_ = 0;
+
+    // The live Snapshot's state, or null. Changed only with every
+    // shard's writer lock held.
+    std::atomic<Frozen *> frozen_{nullptr};
+
+    std::atomic<size_t> keys_{0};
+    std::atomic<size_t> logical_bytes_{0};
+    std::atomic<size_t> index_bytes_{0};
+};
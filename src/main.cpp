@@ -76,16 +76,27 @@ void StartMetricsServer(Node *node, int port)
         .detach();
 }
 
-void RunServer(const std::string &address,
+bool RunServer(const std::string &address,
                const std::vector<std::string> &peers)
 {
+    int port = std::stoi(address.substr(address.find(":") + 1));
+
+    NodeConfig config;
+    config.node_id = port;
+
     Node node("wal_" + address,
-              peers);
+              peers,
+              config);
+
+    if (!node.recover())
+    {
+        std::cout << "Corrupt snapshot in wal_" << address << "\n";
+        return false;
+    }
 
-    node.recover();
     node.start();
 
-    int metrics_port = std::stoi(address.substr(address.find(":") + 1)) + 1000;
+    int metrics_port = port + 1000;
     StartMetricsServer(&node, metrics_port);
 
     KVServiceImpl kv_service(&node);
@@ -108,6 +119,7 @@ void RunServer(const std::string &address,
               << address << "\n";
 
     server->Wait();
+    return true;
 }
 
 int main(int argc, char **argv)
@@ -122,12 +134,19 @@ int main(int argc, char **argv)
 
     std::string address = "0.0.0.0:" + port;
 
-    std::vector<std::string> peers = {
+    std::vector<std::string> cluster = {
         "localhost:50051",
         "localhost:50052",
         "localhost:50053"};
 
-    RunServer(address, peers);
+    // Peers are the other members; we vote for ourselves.
+    std::vector<std::string> peers;
+
+    for (const auto &member : cluster)
+    {
+        if (member != "localhost:" + port)
+            peers.push_back(member);
+    }
 
-    return 0;
+    return RunServer(address, peers) ? 0 : 1;
 }
\ No newline at end of file
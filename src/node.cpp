@@ -1,12 +1,71 @@
 #include "node.h"
+#include "mapped_file.h"
 #include "replication_manager.h"
+#include "snapshot_format.h"
+#include <algorithm>
 #include <iostream>
 #include <random>
 
+// Per-follower AppendEntries window over a long-lived stream.
+// Guards nextIndex_[i].
+struct FollowerPipeline
+{
+    // A packet written on the stream and not yet acknowledged.
+    struct InflightAppend
+    {
+        int64_t from;
+        int64_t last;
+        uint64_t generation;
+    };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    // Opened by the sender, dropped by the ack thread when it breaks.
+    std::shared_ptr<ReplicationStream> stream;
+
+    // Acks arrive in packet order, so the oldest entry matches the
+    // next ack.
+    std::deque<InflightAppend> inflight;
+
+    // Bumped on every rewind so rejects for packets sent before it
+    // are ignored.
+    uint64_t generation = 0;
+};
+
+// The snapshot chain's files, mapped, and the images in them.
+struct SnapshotChain
+{
+    std::deque<MappedFile> files;
+    std::vector<snapshot_format::Image> images;
+
+    // False if a file is missing or unreadable, or the images do not
+    // form a chain. Checksums are left to whoever reads the records.
+    bool open(const std::vector<std::string> &paths)
+    {
+        for (const auto &path : paths)
+        {
+            MappedFile &file = files.emplace_back();
+
+            if (!file.open(path) ||
+                !snapshot_format::split(file.data(), file.size(), images))
+                return false;
+        }
+
+        return snapshot_format::isChain(images);
+    }
+
+    uint64_t lastIndex() const { return images.back().header.last_index; }
+};
+
 Node::Node(const std::string &wal_file,
-           const std::vector<std::string> &peers)
-    : wal_(std::make_unique<WALAdapter>(wal_file)),
+           const std::vector<std::string> &peers,
+           const NodeConfig &config)
+    : config_(config),
+      store_(config.kv_shards),
+      wal_(std::make_unique<WALAdapter>(wal_file)),
       peers_(peers),
+      replication_(std::make_unique<ReplicationManager>(peers, config)),
       last_index_(0),
       commit_index_(0),
       last_applied_(0),
@@ -15,51 +74,124 @@ Node::Node(const std::string &wal_file,
       role_(Role::FOLLOWER),
       running_(true),
       last_heartbeat_time_(std::chrono::steady_clock::now().time_since_epoch().count()),
+      last_leader_contact_(0),
+      lease_until_(0),
+      leader_start_index_(0),
+      snapshots_total_(0),
+      snapshot_merges_total_(0),
       elections_total_(0),
       replication_failures_total_(0)
 {
     nextIndex_.resize(peers.size(), 1);
     matchIndex_.resize(peers.size(), 0);
+
+    for (size_t i = 0; i < peers.size(); ++i)
+        pipelines_.push_back(std::make_unique<FollowerPipeline>());
 }
 
+Node::~Node() = default;
+
 void Node::start()
 {
     std::thread(&Node::electionLoop, this).detach();
+    std::thread(&Node::heartbeatLoop, this).detach();
+    std::thread(&Node::commitLoop, this).detach();
+    std::thread(&Node::applyLoop, this).detach();
+    std::thread(&Node::snapshotLoop, this).detach();
+
+    for (size_t i = 0; i < peers_.size(); ++i)
+    {
+        std::thread(&Node::replicationLoop, this, (int)i).detach();
+        std::thread(&Node::ackLoop, this, (int)i).detach();
+    }
 }
 
-void Node::recover()
+size_t Node::recoveryThreads() const
 {
-    std::string snap;
-    uint64_t snapIndex;
+    if (config_.recovery_threads > 0)
+        return config_.recovery_threads;
 
-    if (wal_->loadSnapshot(snap, snapIndex))
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+bool Node::recover()
+{
+    // Parsed straight out of the page cache; the mappings go away once
+    // the store has its own copies.
+    std::vector<std::string> paths = wal_->snapshotChain();
+
+    if (!paths.empty())
     {
-        store_.deserialize(snap);
-        last_index_ = snapIndex;
-        commit_index_ = snapIndex;
-        last_applied_ = snapIndex;
+        SnapshotChain chain;
+
+        if (!chain.open(paths) ||
+            !store_.deserialize(chain.images, recoveryThreads()))
+            return false;
+
+        last_index_ = chain.lastIndex();
+        commit_index_ = chain.lastIndex();
+        last_applied_ = chain.lastIndex();
     }
 
-    auto ops = wal_->replay();
+    // The log was indexed when the WAL opened; its entries are read in
+    // place from the mapped segments, a run at a time.
+    const size_t REPLAY_CHUNK = 1024;
+    std::vector<LogEntry> entries;
 
-    for (const auto &op : ops)
+    for (wal_->read(last_index_ + 1, REPLAY_CHUNK, entries);
+         !entries.empty();
+         wal_->read(last_index_ + 1, REPLAY_CHUNK, entries))
     {
-        store_.put(op.key, op.value);
-        last_index_ = op.index;
+        for (const LogEntry &entry : entries)
+            apply(entry);
+
+        last_index_ = entries.back().index;
     }
 
     commit_index_.store(last_index_.load());
     last_applied_.store(commit_index_.load());
+    return true;
 }
 
 bool Node::get(const std::string &key,
-               std::string &value)
+               ValueRef &value)
 {
     return store_.get(key, value);
 }
 
+void Node::multiGet(const std::vector<std::string> &keys,
+                    std::vector<ValueRef> &values)
+{
+    store_.multiGet(keys, values);
+}
+
+void Node::apply(const LogEntry &entry)
+{
+    switch (entry.kind)
+    {
+    case EntryKind::PUT:
+        store_.put(entry.key, entry.value);
+        break;
+    case EntryKind::BATCH:
+        store_.put(entry.batch);
+        break;
+    case EntryKind::NOOP:
+        break;
+    }
+}
+
+void Node::scan(const std::string &start,
+                const std::string &end,
+                size_t limit,
+                std::vector<std::pair<std::string, ValueRef>> &out)
+{
+    store_.scan(start, end, limit, out);
+}
+
 void Node::updateTerm(int64_t term)
 {
+    std::lock_guard<std::mutex> lock(election_mutex_);
+
     if (term > current_term_)
     {
         current_term_ = term;
@@ -70,40 +202,95 @@ void Node::updateTerm(int64_t term)
 
 bool Node::requestVote(int64_t term,
                        int64_t candidate_id,
-                       int64_t last_log_index)
+                       int64_t last_log_index,
+                       int64_t last_log_term)
 {
     std::lock_guard<std::mutex> lock(election_mutex_);
 
     if (term < current_term_)
         return false;
 
+    int64_t now =
+        std::chrono::steady_clock::now()
+            .time_since_epoch()
+            .count();
+
+    // Don't help depose a leader we still hear from: its read lease
+    // relies on no new leader appearing before it expires.
+    bool leaderAlive =
+        role_ == Role::LEADER ||
+        (role_ == Role::FOLLOWER &&
+         now - last_heartbeat_time_.load() <
+             config_.election_timeout_min_ms * 1'000'000LL);
+
+    if (leaderAlive && voted_for_ != candidate_id)
+        return false;
+
+    if (term > current_term_)
+    {
+        current_term_ = term;
+        role_ = Role::FOLLOWER;
+        voted_for_ = -1;
+    }
+
+    // Only a candidate whose log is at least as up to date as ours:
+    // a later last term, or the same one and at least as long.
+    int64_t lastIndex = last_index_.load();
+    int64_t lastTerm = termAt(lastIndex);
+
+    if (last_log_term < lastTerm ||
+        (last_log_term == lastTerm && last_log_index < lastIndex))
+        return false;
+
     if (voted_for_ == -1 || voted_for_ == candidate_id)
     {
         voted_for_ = candidate_id;
-        current_term_ = term;
+        last_heartbeat_time_ = now;
         return true;
     }
 
     return false;
 }
 
-void Node::receiveHeartbeat(int64_t term)
+bool Node::receiveHeartbeat(int64_t term)
 {
-    if (term >= current_term_)
+    std::lock_guard<std::mutex> lock(election_mutex_);
+
+    if (term < current_term_)
+        return false;
+
+    if (term > current_term_)
     {
-        role_ = Role::FOLLOWER;
         current_term_ = term;
-        last_heartbeat_time_ =
-            std::chrono::steady_clock::now()
-                .time_since_epoch()
-                .count();
+        voted_for_ = -1;
     }
+
+    int64_t now =
+        std::chrono::steady_clock::now()
+            .time_since_epoch()
+            .count();
+
+    role_ = Role::FOLLOWER;
+    last_heartbeat_time_ = now;
+    last_leader_contact_ = now;
+    return true;
+}
+
+int64_t Node::termAt(int64_t index) const
+{
+    std::shared_lock<std::shared_mutex> lock(log_mutex_);
+    return wal_->termAt(index);
+}
+
+bool Node::matchesLog(int64_t index, int64_t term) const
+{
+    std::shared_lock<std::shared_mutex> lock(log_mutex_);
+    return index <= (int64_t)wal_->snapshotIndex() || wal_->termAt(index) == term;
 }
 
 void Node::appendFromLeader(const Operation &op)
 {
-    if (op.term < current_term_)
-        return;
+    std::unique_lock<std::shared_mutex> lock(log_mutex_);
 
     // Raft conflict repair:
     if (op.index <= wal_->lastIndex())
@@ -115,136 +302,756 @@ void Node::appendFromLeader(const Operation &op)
     last_index_.store(op.index);
 }
 
+void Node::signalApply()
+{
+    {
+        std::lock_guard<std::mutex> lock(apply_queue_mutex_);
+    }
+    apply_queue_cv_.notify_one();
+}
+
+void Node::setCommitIndex(int64_t idx)
+{
+    commit_index_.store(idx);
+    signalApply();
+}
+
+void Node::applyLoop()
+{
+    while (running_)
+    {
+        int64_t target;
+
+        {
+            // A follower can learn a commit index before it holds the
+            // entries; those wait for the append that brings them.
+            auto applicable = [this]
+            { return std::min(commit_index_.load(), last_index_.load()); };
+
+            std::unique_lock<std::mutex> lock(apply_queue_mutex_);
+            apply_queue_cv_.wait(lock, [&]
+                                 { return !running_ ||
+                                          applicable() > last_applied_.load(); });
+            target = applicable();
+        }
+
+        applyUpTo(target);
+
+        // Puts complete once applied, so a leader read sees them.
+        notifyCommit();
+
+        size_t logEntries, logBytes;
+        {
+            std::shared_lock<std::shared_mutex> lock(log_mutex_);
+            logEntries = wal_->count();
+            logBytes = wal_->bytes();
+        }
+
+        if (logEntries > config_.snapshot_log_entries ||
+            logBytes > config_.snapshot_log_bytes)
+        {
+            createSnapshot();
+        }
+    }
+}
+
 void Node::applyUpTo(int64_t commit_index)
 {
-    const auto &log = wal_->inMemoryLog();
+    // Entries per hold of log_mutex_, so appends from the leader or the
+    // batcher can slip in during a long apply.
+    const int64_t APPLY_CHUNK = 64;
+
+    std::lock_guard<std::mutex> state(state_mutex_);
+    std::vector<LogEntry> entries;
 
     while (last_applied_.load() < commit_index)
     {
-        int64_t next = last_applied_.load();
+        // The entries are views into the log, so they are applied before
+        // the lock is let go.
+        std::shared_lock<std::shared_mutex> lock(log_mutex_);
+        int64_t end = std::min(commit_index, last_applied_.load() + APPLY_CHUNK);
 
-        if (next >= log.size())
-            break;
+        wal_->read(last_applied_.load() + 1, end - last_applied_.load(), entries);
+
+        for (const LogEntry &entry : entries)
+        {
+            apply(entry);
+            last_applied_++;
+        }
 
-        const auto &op = log[next];
+        if (last_applied_.load() < end)
+            break;
+    }
 
-        store_.put(op.key, op.value);
-        last_applied_++;
+    {
+        std::lock_guard<std::mutex> apply_lock(apply_mutex_);
     }
+    apply_cv_.notify_all();
 }
 
 void Node::createSnapshot()
 {
-    std::string serialized = store_.serialize();
-    wal_->createSnapshot(serialized, commit_index_.load());
+    std::unique_lock<std::mutex> lock(snapshot_mutex_);
+
+    if (snapshot_running_)
+        return;
+
+    // A delta needs a snapshot to build on, and the store to have
+    // tracked every write since it.
+    bool delta = !snapshot_needs_full_ && !wal_->snapshotChain().empty();
+
+    {
+        // The view and its index must match, so no apply in between.
+        std::lock_guard<std::mutex> state(state_mutex_);
+        snapshot_ = store_.snapshot(delta);
+        snapshot_index_ = last_applied_.load();
+
+        // Applied entries are still in the log until this snapshot
+        // compacts them.
+        snapshot_term_ = termAt(snapshot_index_);
+        if (snapshot_term_ < 0)
+            snapshot_term_ = current_term_.load();
+    }
+
+    if (!snapshot_)
+        return;
+
+    snapshot_running_ = true;
+    lock.unlock();
+    snapshot_cv_.notify_all();
+}
+
+void Node::snapshotLoop()
+{
+    while (running_)
+    {
+        std::unique_lock<std::mutex> lock(snapshot_mutex_);
+        snapshot_cv_.wait(lock, [this]
+                          { return !running_ || snapshot_; });
+
+        if (!snapshot_)
+            continue;
+
+        int64_t index = snapshot_index_;
+        int64_t term = snapshot_term_;
+        lock.unlock();
+
+        // The slow part, off every foreground path: writers carry on
+        // and copy-on-write keeps the view intact. The image goes to
+        // disk a chunk at a time and is never held whole.
+        bool delta = snapshot_->delta();
+        bool written =
+            wal_->beginSnapshot() &&
+            snapshot_->write(index, term, config_.snapshot_chunk_bytes,
+                             [this](const char *data, size_t size)
+                             { return wal_->writeSnapshot(data, size); });
+
+        if (written)
+        {
+            std::unique_lock<std::shared_mutex> log(log_mutex_);
+            written = delta ? wal_->commitDelta(index)
+                            : wal_->commitSnapshot(index);
+        }
+        else
+            wal_->abortSnapshot();
+
+        if (written)
+            snapshots_total_++;
+
+        if (written && delta)
+            mergeSnapshots();
+
+        lock.lock();
+        snapshot_needs_full_ = !written;
+        snapshot_.reset();
+        snapshot_running_ = false;
+        lock.unlock();
+        snapshot_cv_.notify_all();
+    }
 }
 
-void Node::installSnapshot(const std::string &data,
+void Node::mergeSnapshots()
+{
+    SnapshotChain chain;
+
+    if (!chain.open(wal_->snapshotChain()) || chain.images.size() < 2)
+        return;
+
+    size_t deltaBytes = 0;
+
+    for (size_t i = 1; i < chain.images.size(); ++i)
+        deltaBytes += chain.images[i].size;
+
+    if (deltaBytes <= chain.images.front().size * config_.snapshot_merge_ratio &&
+        chain.images.size() - 1 <= config_.snapshot_max_deltas)
+        return;
+
+    // Reads only the files, so the store and writers are untouched. The
+    // merged image covers exactly what the chain did, so the log is
+    // already compacted up to it.
+    bool merged =
+        wal_->beginSnapshot() &&
+        snapshot_format::merge(chain.images, config_.snapshot_chunk_bytes,
+                               [this](const char *data, size_t size)
+                               { return wal_->writeSnapshot(data, size); });
+
+    if (merged)
+    {
+        std::unique_lock<std::shared_mutex> log(log_mutex_);
+        merged = wal_->commitSnapshot(chain.lastIndex());
+    }
+    else
+        wal_->abortSnapshot();
+
+    if (merged)
+        snapshot_merges_total_++;
+}
+
+bool Node::installSnapshot(const std::string &path,
                            uint64_t lastIndex,
                            uint64_t lastTerm)
 {
-    // Replace KV state
-    store_.deserialize(data);
+    SnapshotChain chain;
 
-    // Replace WAL below snapshot
-    wal_->createSnapshot(data, lastIndex);
+    if (!chain.open({path}) || chain.lastIndex() != lastIndex)
+        return false;
+
+    // A background snapshot still reads the store we are replacing, so
+    // wait it out; holding snapshot_mutex_ keeps a new one from starting.
+    // It is taken before state_mutex_, as in createSnapshot.
+    std::unique_lock<std::mutex> snapshot(snapshot_mutex_);
+    snapshot_cv_.wait(snapshot, [this]
+                      { return !snapshot_running_; });
+
+    // Keep the apply thread out until the store and indices agree again.
+    std::lock_guard<std::mutex> state(state_mutex_);
+
+    // Replace KV state, reading the images in place
+    if (!store_.deserialize(chain.images, recoveryThreads()))
+        return false;
+
+    chain.files.clear();
+
+    std::unique_lock<std::shared_mutex> lock(log_mutex_);
+
+    // The received file becomes the local snapshot; the log below it is
+    // compacted away.
+    bool durable = wal_->adoptSnapshot(path, lastIndex);
 
     last_index_ = lastIndex;
     commit_index_ = lastIndex;
     last_applied_ = lastIndex;
 
     current_term_ = lastTerm;
+    return durable;
 }
 
 /* ============================
-   RAFT BACKTRACKING SECTION
+   GROUP COMMIT
 ============================= */
 
 bool Node::replicateAndCommit(const std::string &key,
-                              const std::string &value)
+                              const std::string &value,
+                              int64_t *index)
+{
+    Operation op;
+    op.key = key;
+    op.value = value;
+
+    return propose(std::move(op), index);
+}
+
+bool Node::replicateAndCommit(std::vector<std::pair<std::string, std::string>> batch,
+                              int64_t *index)
+{
+    Operation op;
+    op.kind = EntryKind::BATCH;
+    op.batch = std::move(batch);
+
+    return propose(std::move(op), index);
+}
+
+bool Node::propose(Operation op, int64_t *index)
 {
     if (role_ != Role::LEADER)
         return false;
 
-    int64_t idx = ++last_index_;
+    Proposal proposal;
+    proposal.op = std::move(op);
 
-    Operation local_op{idx,
-                       current_term_.load(),
-                       key,
-                       value};
+    std::future<int64_t> committed = proposal.committed.get_future();
 
-    wal_->append(local_op);
+    {
+        std::lock_guard<std::mutex> lock(proposal_mutex_);
+        proposals_.push_back(std::move(proposal));
+    }
+    proposal_cv_.notify_one();
 
-    for (size_t i = 0; i < peers_.size(); ++i)
-        replicateToFollower(i);
+    int64_t committedIndex = committed.get();
 
-    updateCommitIndex();
+    if (index)
+        *index = committedIndex;
 
-    if (commit_index_.load() >= idx)
+    return committedIndex != 0;
+}
+
+void Node::commitLoop()
+{
+    while (running_)
     {
-        applyUpTo(commit_index_.load());
-        if (wal_->inMemoryLog().size() > 1000)
+        std::vector<Proposal> batch;
+
         {
-            createSnapshot();
+            std::unique_lock<std::mutex> lock(proposal_mutex_);
+
+            auto ready = [this]
+            {
+                return !running_ || !proposals_.empty() ||
+                       (!pending_.empty() &&
+                        last_applied_.load() >= pending_.front().op.index);
+            };
+
+            if (pending_.empty())
+                proposal_cv_.wait(lock, ready);
+            else
+                proposal_cv_.wait_until(lock, pending_.front().deadline, ready);
+
+            // Everything that queued up since the last append goes out
+            // together.
+            while (!proposals_.empty() &&
+                   batch.size() < config_.max_proposal_batch)
+            {
+                batch.push_back(std::move(proposals_.front()));
+                proposals_.pop_front();
+            }
         }
-        return true;
+
+        if (!batch.empty())
+            commitBatch(batch);
+
+        completePending();
     }
+}
 
-    return false;
+void Node::commitBatch(std::vector<Proposal> &batch)
+{
+    if (role_ != Role::LEADER)
+    {
+        for (auto &p : batch)
+            p.committed.set_value(0);
+        return;
+    }
+
+    int64_t term = current_term_.load();
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(config_.commit_timeout_ms);
+
+    std::vector<Operation> ops;
+    ops.reserve(batch.size());
+
+    for (auto &p : batch)
+    {
+        p.op.term = term;
+        p.deadline = deadline;
+        ops.push_back(std::move(p.op));
+    }
+
+    {
+        // Indices are taken under the lock, as a new leader's no-op may
+        // be appended meanwhile. Publish last_index_ only once the
+        // entries are readable, so a sender never sees an index it
+        // cannot find in the log.
+        std::unique_lock<std::shared_mutex> lock(log_mutex_);
+        int64_t index = last_index_.load();
+
+        for (auto &op : ops)
+            op.index = ++index;
+
+        wal_->appendBatch(ops);
+        last_index_.store(index);
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        batch[i].op.index = ops[i].index;
+        batch[i].op.term = term;
+        pending_.push_back(std::move(batch[i]));
+    }
+
+    {
+        // A single-node cluster commits on its own.
+        std::lock_guard<std::mutex> lock(commit_mutex_);
+        updateCommitIndex();
+    }
+
+    // Don't wait for the quorum: the next batch can go out while this
+    // one is still in the follower pipelines.
+    signalReplication();
+}
+
+void Node::completePending()
+{
+    int64_t applied = last_applied_.load();
+
+    auto now = std::chrono::steady_clock::now();
+    bool leader = role_ == Role::LEADER;
+
+    while (!pending_.empty())
+    {
+        Proposal &p = pending_.front();
+
+        if (p.op.index <= applied)
+        {
+            // After a change of leader another entry may have committed
+            // at this index; only ours carries our term. If it has been
+            // compacted since, it is ours as long as we have led in its
+            // term throughout.
+            bool ours = termAt(p.op.index) == p.op.term ||
+                        (leader && current_term_.load() == p.op.term);
+
+            p.committed.set_value(ours ? p.op.index : 0);
+        }
+        else if (!leader || now >= p.deadline)
+            p.committed.set_value(0);
+        else
+            break;
+
+        pending_.pop_front();
+    }
 }
 
-bool Node::replicateToFollower(int followerIndex)
+void Node::notifyCommit()
 {
-    ReplicationManager manager({peers_[followerIndex]});
+    {
+        std::lock_guard<std::mutex> lock(proposal_mutex_);
+    }
+    proposal_cv_.notify_one();
+}
+
+/* ============================
+   FOLLOWER PIPELINES
+============================= */
+
+void Node::signalReplication()
+{
+    for (auto &pipe : pipelines_)
+    {
+        {
+            std::lock_guard<std::mutex> lock(pipe->mutex);
+        }
+        pipe->cv.notify_all();
+    }
+}
 
-    const auto &log = wal_->inMemoryLog();
-    int64_t nextIdx = nextIndex_[followerIndex];
-    // follower behind snapshot?
-    uint64_t snapIndex;
-    std::string snapData;
+void Node::replicationLoop(int followerIndex)
+{
+    FollowerPipeline &pipe = *pipelines_[followerIndex];
 
-    if (wal_->loadSnapshot(snapData, snapIndex))
+    while (running_)
     {
-        if (nextIdx <= snapIndex)
+        int64_t from;
+        uint64_t generation;
+        std::shared_ptr<ReplicationStream> stream;
+
         {
-            ReplicationManager mgr({peers_[followerIndex]});
-            bool ok = mgr.sendSnapshotStream(
-                peers_[followerIndex],
-                snapData,
-                snapIndex,
-                current_term_.load());
-            if (ok)
+            std::unique_lock<std::mutex> lock(pipe.mutex);
+            pipe.cv.wait(lock, [&]
+                         { return !running_ ||
+                                  (role_ == Role::LEADER &&
+                                   nextIndex_[followerIndex] <= last_index_.load() &&
+                                   pipe.inflight.size() < config_.max_inflight_appends); });
+
+            if (!running_)
+                break;
+
+            from = nextIndex_[followerIndex];
+            generation = pipe.generation;
+            stream = pipe.stream;
+        }
+
+        kv::ReplicationPacket packet;
+
+        if (!buildAppendPacket(from, packet))
+        {
+            // Compacted into a snapshot: let the window drain, then ship
+            // the snapshot instead.
             {
-                nextIndex_[followerIndex] = snapIndex + 1;
-                matchIndex_[followerIndex] = snapIndex;
-                return true;
+                std::unique_lock<std::mutex> lock(pipe.mutex);
+                pipe.cv.wait(lock, [&]
+                             { return pipe.inflight.empty(); });
             }
-            return false;
+
+            if (!sendSnapshotToFollower(followerIndex))
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(config_.replication_retry_ms));
+            continue;
+        }
+
+        if (!stream)
+        {
+            stream = replication_->openStream(followerIndex);
+
+            {
+                std::lock_guard<std::mutex> lock(pipe.mutex);
+                pipe.stream = stream;
+            }
+            pipe.cv.notify_all();
+        }
+
+        int64_t last = from + packet.ops_size() - 1;
+
+        {
+            std::lock_guard<std::mutex> lock(pipe.mutex);
+
+            // A reject rewound the window, or the stream broke, while we
+            // were packing.
+            if (pipe.generation != generation ||
+                nextIndex_[followerIndex] != from ||
+                pipe.stream != stream)
+                continue;
+
+            pipe.inflight.push_back({from, last, generation});
+
+            // Optimistic: the next packet starts after this one.
+            nextIndex_[followerIndex] = last + 1;
+        }
+
+        if (!stream->stream->Write(packet))
+        {
+            // The ack thread sees the same failure and rewinds; wait for
+            // it before opening a new stream.
+            std::unique_lock<std::mutex> lock(pipe.mutex);
+            pipe.cv.wait(lock, [&]
+                         { return !running_ || pipe.stream != stream; });
         }
     }
+}
 
-    kv::Operation proto_op;
-    proto_op.set_index(log[nextIdx - 1].index);
-    proto_op.set_term(log[nextIdx - 1].term);
-    proto_op.set_key(log[nextIdx - 1].key);
-    proto_op.set_value(log[nextIdx - 1].value);
+void Node::ackLoop(int followerIndex)
+{
+    FollowerPipeline &pipe = *pipelines_[followerIndex];
+
+    while (running_)
+    {
+        std::shared_ptr<ReplicationStream> stream;
 
-    int success = manager.replicate(proto_op,
-                                    commit_index_.load());
+        {
+            std::unique_lock<std::mutex> lock(pipe.mutex);
+            pipe.cv.wait(lock, [&]
+                         { return !running_ || pipe.stream; });
+            stream = pipe.stream;
+        }
+
+        if (!stream)
+            break;
 
-    if (success > 0)
+        kv::ReplicationAck ack;
+
+        while (stream->stream->Read(&ack))
+        {
+            FollowerPipeline::InflightAppend append;
+
+            {
+                std::lock_guard<std::mutex> lock(pipe.mutex);
+
+                if (pipe.inflight.empty())
+                    continue;
+
+                append = pipe.inflight.front();
+                pipe.inflight.pop_front();
+            }
+            pipe.cv.notify_all();
+
+            if (ack.success())
+            {
+                advanceMatchIndex(followerIndex, append.last);
+                continue;
+            }
+
+            replication_failures_total_++;
+
+            if (ack.term() > current_term_.load())
+                updateTerm(ack.term());
+
+            // A follower that reports a longer log than we have matched
+            // lets us resume there instead.
+            rewindFollower(followerIndex, append.generation,
+                           std::min(ack.last_index() + 1, append.from));
+        }
+
+        // Stream broke: drop the window and fall back to matchIndex.
+        replication_failures_total_++;
+        stream->context.TryCancel();
+
+        int64_t matched;
+        {
+            std::lock_guard<std::mutex> lock(commit_mutex_);
+            matched = matchIndex_[followerIndex];
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(pipe.mutex);
+
+            if (pipe.stream == stream)
+            {
+                pipe.stream.reset();
+                pipe.inflight.clear();
+                nextIndex_[followerIndex] = matched + 1;
+                pipe.generation++;
+            }
+        }
+        pipe.cv.notify_all();
+
+        std::this_thread::sleep_for(
+            std::chrono::milliseconds(config_.replication_retry_ms));
+    }
+}
+
+void Node::rewindFollower(int followerIndex,
+                          uint64_t generation,
+                          int64_t resumeAt)
+{
+    int64_t matched;
     {
-        matchIndex_[followerIndex] = nextIdx;
-        nextIndex_[followerIndex] = nextIdx + 1;
-        return true;
+        std::lock_guard<std::mutex> lock(commit_mutex_);
+        matched = matchIndex_[followerIndex];
     }
-    else
+
+    FollowerPipeline &pipe = *pipelines_[followerIndex];
+
+    {
+        std::lock_guard<std::mutex> lock(pipe.mutex);
+
+        // Already rewound for an earlier packet in the same window.
+        if (generation != pipe.generation)
+            return;
+
+        nextIndex_[followerIndex] = std::max(matched + 1, resumeAt);
+        pipe.generation++;
+    }
+    pipe.cv.notify_all();
+}
+
+void Node::advanceMatchIndex(int followerIndex, int64_t index)
+{
+    {
+        std::lock_guard<std::mutex> lock(commit_mutex_);
+        matchIndex_[followerIndex] =
+            std::max(matchIndex_[followerIndex], index);
+        updateCommitIndex();
+    }
+    notifyCommit();
+}
+
+/* ============================
+   RAFT BACKTRACKING SECTION
+============================= */
+
+bool Node::buildAppendPacket(int64_t from, kv::ReplicationPacket &packet)
+{
+    // Pack everything from `from` up to last_index, within the caps.
+    packet.set_term(current_term_.load());
+    packet.set_commit_index(commit_index_.load());
+    packet.set_from_index(from);
+
+    size_t bytes = 0;
+
+    std::shared_lock<std::shared_mutex> lock(log_mutex_);
+
+    // The follower checks it holds the entry before the batch. Unknown
+    // only if it was compacted below our snapshot, which then goes
+    // instead.
+    int64_t prevTerm = wal_->termAt(from - 1);
+
+    if (prevTerm < 0)
+        return false;
+
+    packet.set_prev_log_index(from - 1);
+    packet.set_prev_log_term(prevTerm);
+
+    // Entries are views into the log, read a run at a time; the copies
+    // into the packet are the only ones made.
+    const size_t READ_CHUNK = 256;
+    std::vector<LogEntry> entries;
+    bool full = false;
+
+    for (int64_t idx = from; !full && idx <= last_index_.load(); idx += entries.size())
+    {
+        wal_->read(idx, std::min<size_t>(READ_CHUNK, last_index_.load() - idx + 1), entries);
+
+        if (entries.empty())
+            break;
+
+        for (const LogEntry &entry : entries)
+        {
+            size_t size = entry.key.size() + entry.value.size();
+
+            for (const auto &[key, value] : entry.batch)
+                size += key.size() + value.size();
+
+            if (packet.ops_size() > 0 &&
+                ((size_t)packet.ops_size() >= config_.max_append_entries ||
+                 bytes + size > config_.max_append_bytes))
+            {
+                full = true;
+                break;
+            }
+
+            kv::Operation *proto_op = packet.add_ops();
+            proto_op->set_index(entry.index);
+            proto_op->set_term(entry.term);
+            proto_op->set_kind((uint32_t)entry.kind);
+            proto_op->set_key(entry.key.data(), entry.key.size());
+            proto_op->set_value(entry.value.data(), entry.value.size());
+
+            for (const auto &[key, value] : entry.batch)
+            {
+                kv::KeyValue *write = proto_op->add_batch();
+                write->set_key(key.data(), key.size());
+                write->set_value(value.data(), value.size());
+            }
+
+            bytes += size;
+        }
+    }
+
+    return packet.ops_size() > 0;
+}
+
+bool Node::sendSnapshotToFollower(int followerIndex)
+{
+    // Sent straight from the page cache, the whole chain in one stream.
+    // A new snapshot renamed over a file meanwhile leaves its mapping on
+    // the old one, intact; a merge that removes a delta before it is
+    // mapped just fails this attempt.
+    SnapshotChain chain;
+
+    if (!chain.open(wal_->snapshotChain()))
+        return false;
+
+    uint64_t snapIndex = chain.lastIndex();
+
+    bool ok = replication_->sendSnapshotStream(
+        followerIndex,
+        chain.images,
+        snapIndex,
+        current_term_.load());
+
+    if (!ok)
     {
         replication_failures_total_++;
-        if (nextIndex_[followerIndex] > 1)
-            nextIndex_[followerIndex]--;
         return false;
     }
+
+    {
+        FollowerPipeline &pipe = *pipelines_[followerIndex];
+        std::lock_guard<std::mutex> lock(pipe.mutex);
+        nextIndex_[followerIndex] = snapIndex + 1;
+        pipe.generation++;
+    }
+
+    advanceMatchIndex(followerIndex, snapIndex);
+    return true;
 }
 
 void Node::updateCommitIndex()
@@ -263,7 +1070,14 @@ void Node::updateCommitIndex()
 
         if (count > peers_.size() / 2)
         {
-            commit_index_.store(N);
+            // A quorum alone commits only an entry from our own term;
+            // earlier ones commit with it. Terms only grow along the
+            // log, so nothing below N qualifies either.
+            if (termAt(N) == current_term_.load())
+            {
+                commit_index_.store(N);
+                signalApply();
+            }
             break;
         }
     }
@@ -277,7 +1091,9 @@ void Node::electionLoop()
 {
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<> timeout_dist(150, 300);
+    std::uniform_int_distribution<> timeout_dist(
+        config_.election_timeout_min_ms,
+        config_.election_timeout_max_ms);
 
     while (running_)
     {
@@ -303,46 +1119,282 @@ void Node::electionLoop()
 
 void Node::startElection()
 {
+    int64_t term;
+
+    {
+        std::lock_guard<std::mutex> lock(election_mutex_);
+
+        role_ = Role::CANDIDATE;
+        term = ++current_term_;
+        voted_for_ = config_.node_id;
+        elections_total_++;
+    }
+
+    // Don't hold election_mutex_ across the round: a leader's heartbeat
+    // or a higher-term vote request may arrive meanwhile.
+    int64_t lastIndex = last_index_.load();
+
+    int votes = replication_->requestVotes(
+        term,
+        config_.node_id,
+        lastIndex,
+        termAt(lastIndex));
+
     std::lock_guard<std::mutex> lock(election_mutex_);
 
-    role_ = Role::CANDIDATE;
-    current_term_++;
-    voted_for_ = 0;
-    elections_total_++;
-    ReplicationManager manager(peers_);
+    // Stepped down to another leader while we were waiting.
+    if (current_term_ != term || role_ != Role::CANDIDATE)
+        return;
 
-    int votes = manager.requestVotes(
-        current_term_.load(),
-        0,
-        last_index_.load());
+    int majority = (peers_.size() + 1) / 2 + 1;
 
-    if (votes == -1)
+    if (votes < majority)
     {
         role_ = Role::FOLLOWER;
         return;
     }
 
-    int majority = (peers_.size() + 1) / 2 + 1;
+    // Matches from an earlier term say nothing about this one.
+    {
+        std::lock_guard<std::mutex> commit_lock(commit_mutex_);
+        std::fill(matchIndex_.begin(), matchIndex_.end(), 0);
+    }
 
-    if (votes >= majority)
+    // Resend our uncommitted tail, with the no-op below after it;
+    // entries followers already hold are skipped.
+    for (size_t i = 0; i < pipelines_.size(); ++i)
     {
-        role_ = Role::LEADER;
-        sendHeartbeats();
+        std::lock_guard<std::mutex> pipe_lock(pipelines_[i]->mutex);
+        nextIndex_[i] = commit_index_.load() + 1;
+        pipelines_[i]->generation++;
     }
-    else
+
+    // A no-op in our own term. Entries from earlier terms only commit
+    // with one from ours, so this commits them without waiting for a
+    // Put, and once it commits reads know they see every earlier write.
+    Operation noop;
+    noop.term = term;
+    noop.kind = EntryKind::NOOP;
     {
-        role_ = Role::FOLLOWER;
+        std::unique_lock<std::shared_mutex> log_lock(log_mutex_);
+        noop.index = last_index_.load() + 1;
+        wal_->append(noop);
+        last_index_.store(noop.index);
+    }
+
+    lease_until_ = 0;
+    leader_start_index_ = noop.index;
+    role_ = Role::LEADER;
+
+    {
+        // A single-node cluster commits on its own.
+        std::lock_guard<std::mutex> commit_lock(commit_mutex_);
+        updateCommitIndex();
+    }
+
+    requestHeartbeat();
+    signalReplication();
+}
+
+void Node::requestHeartbeat()
+{
+    {
+        std::lock_guard<std::mutex> lock(heartbeat_mutex_);
+        heartbeat_now_ = true;
+    }
+    heartbeat_cv_.notify_one();
+}
+
+void Node::heartbeatLoop()
+{
+    while (running_)
+    {
+        {
+            std::unique_lock<std::mutex> lock(heartbeat_mutex_);
+            heartbeat_cv_.wait_for(
+                lock,
+                std::chrono::milliseconds(config_.heartbeat_interval_ms),
+                [&]
+                { return heartbeat_now_; });
+            heartbeat_now_ = false;
+        }
+
+        if (role_ == Role::LEADER)
+            sendHeartbeats();
     }
 }
 
 void Node::sendHeartbeats()
 {
-    ReplicationManager manager(peers_);
+    int64_t term = current_term_.load();
+    int64_t commit = commit_index_.load();
+
+    uint64_t round;
+    {
+        std::lock_guard<std::mutex> lock(read_index_mutex_);
+        round = ++heartbeat_rounds_started_;
+    }
 
-    kv::Operation empty_op;
+    // The lease runs from when the round was sent, not when the acks
+    // came back: followers reset their timers no earlier than this.
+    int64_t sent =
+        std::chrono::steady_clock::now()
+            .time_since_epoch()
+            .count();
 
-    manager.replicate(empty_op,
-                      commit_index_.load());
+    // A follower may only commit what it is known to share with us, so
+    // cap each one's commit index at its matchIndex.
+    std::vector<kv::ReplicationPacket> packets(peers_.size());
+    {
+        std::lock_guard<std::mutex> lock(commit_mutex_);
+
+        for (size_t i = 0; i < packets.size(); ++i)
+        {
+            packets[i].set_term(term);
+            packets[i].set_commit_index(
+                std::min(commit, matchIndex_[i]));
+        }
+    }
+
+    std::vector<kv::ReplicationAck> acks;
+
+    // Give up on a slow peer before the next tick is due.
+    replication_->replicate(
+        packets,
+        &acks,
+        std::chrono::milliseconds(config_.heartbeat_interval_ms));
+
+    int acked = 1; // self
+
+    for (const auto &ack : acks)
+    {
+        if (ack.term() > term)
+            updateTerm(ack.term());
+        else if (ack.success())
+            acked++;
+    }
+
+    int majority = (peers_.size() + 1) / 2 + 1;
+
+    bool confirmed = acked >= majority && role_ == Role::LEADER &&
+                     current_term_.load() == term;
+
+    if (confirmed)
+        lease_until_ = sent + config_.lease_duration_ms * 1'000'000LL;
+
+    {
+        std::lock_guard<std::mutex> lock(read_index_mutex_);
+        heartbeat_rounds_done_ = round;
+
+        if (confirmed)
+            heartbeat_rounds_confirmed_ = round;
+    }
+    read_index_cv_.notify_all();
+}
+
+/* ============================
+   LINEARIZABLE READS
+============================= */
+
+bool Node::waitForApplied(int64_t index)
+{
+    std::unique_lock<std::mutex> lock(apply_mutex_);
+
+    return apply_cv_.wait_for(
+        lock,
+        std::chrono::milliseconds(config_.read_timeout_ms),
+        [&]
+        { return last_applied_.load() >= index; });
+}
+
+bool Node::confirmLeaseRead()
+{
+    if (role_ != Role::LEADER)
+        return false;
+
+    int64_t now =
+        std::chrono::steady_clock::now()
+            .time_since_epoch()
+            .count();
+
+    if (now >= lease_until_.load())
+        return false;
+
+    // Until the no-op from our election commits, we may not know about
+    // writes the previous leader committed. It goes out right after the
+    // election, so a read just after a failover waits one round trip.
+    if (!waitForApplied(leader_start_index_.load()))
+        return false;
+
+    return waitForApplied(commit_index_.load());
+}
+
+bool Node::confirmReadIndex()
+{
+    if (role_ != Role::LEADER)
+        return false;
+
+    // As in confirmLeaseRead: wait for our election's no-op to commit,
+    // so readIndex covers every write the previous leader committed.
+    if (!waitForApplied(leader_start_index_.load()))
+        return false;
+
+    int64_t readIndex = commit_index_.load();
+
+    // Any round that starts from here on proves we were still leader
+    // when readIndex was taken. Reads arriving while a round is in
+    // flight all wait for the same next one.
+    uint64_t round;
+    {
+        std::lock_guard<std::mutex> lock(read_index_mutex_);
+        round = heartbeat_rounds_started_ + 1;
+    }
+
+    requestHeartbeat();
+
+    {
+        std::unique_lock<std::mutex> lock(read_index_mutex_);
+
+        read_index_cv_.wait_for(
+            lock,
+            std::chrono::milliseconds(config_.read_timeout_ms),
+            [&]
+            { return heartbeat_rounds_done_ >= round; });
+
+        if (heartbeat_rounds_confirmed_ < round)
+            return false;
+    }
+
+    return waitForApplied(readIndex);
+}
+
+bool Node::confirmBoundedRead(int64_t minAppliedIndex,
+                              int64_t maxStalenessMs)
+{
+    if (minAppliedIndex > 0 && !waitForApplied(minAppliedIndex))
+        return false;
+
+    if (maxStalenessMs <= 0)
+        return true;
+
+    // A leader is as fresh as it gets while it still holds a quorum.
+    int64_t now =
+        std::chrono::steady_clock::now()
+            .time_since_epoch()
+            .count();
+
+    if (role_ == Role::LEADER)
+        return now < lease_until_.load();
+
+    // Only a leader's packet counts: a vote we granted resets the
+    // election timer but tells us nothing about what has committed.
+    if (now - last_leader_contact_.load() > maxStalenessMs * 1'000'000LL)
+        return false;
+
+    // Heartbeats apply inline, so this rarely waits. Entries still in
+    // flight to us are covered by the staleness bound.
+    return waitForApplied(
+        std::min(commit_index_.load(), last_index_.load()));
 }
 
 std::string Node::metrics()
@@ -365,8 +1417,27 @@ std::string Node::metrics()
     output += std::to_string(last_applied_.load());
     output += "\n";
 
+    size_t logSize, logBytes;
+    {
+        std::shared_lock<std::shared_mutex> lock(log_mutex_);
+        logSize = wal_->count();
+        logBytes = wal_->bytes();
+    }
+
     output += "raft_log_size ";
-    output += std::to_string(wal_->inMemoryLog().size());
+    output += std::to_string(logSize);
+    output += "\n";
+
+    output += "raft_log_bytes ";
+    output += std::to_string(logBytes);
+    output += "\n";
+
+    output += "raft_snapshots_total ";
+    output += std::to_string(snapshots_total_.load());
+    output += "\n";
+
+    output += "raft_snapshot_merges_total ";
+    output += std::to_string(snapshot_merges_total_.load());
     output += "\n";
 
     output += "raft_elections_total ";
@@ -377,5 +1448,37 @@ std::string Node::metrics()
     output += std::to_string(replication_failures_total_.load());
     output += "\n";
 
+    KVStore::MemoryStats mem = store_.memoryStats();
+
+    output += "kv_keys ";
+    output += std::to_string(mem.keys);
+    output += "\n";
+
+    output += "kv_logical_bytes ";
+    output += std::to_string(mem.logical_bytes);
+    output += "\n";
+
+    output += "kv_index_bytes ";
+    output += std::to_string(mem.index_bytes);
+    output += "\n";
+
+    output += "kv_slab_reserved_bytes ";
+    output += std::to_string(mem.slab_reserved_bytes);
+    output += "\n";
+
+    output += "kv_slab_used_bytes ";
+    output += std::to_string(mem.slab_used_bytes);
+    output += "\n";
+
+    // 0 IDLE, 1 CONNECTING, 2 READY, 3 TRANSIENT_FAILURE, 4 SHUTDOWN
+    for (size_t i = 0; i < replication_->size(); ++i)
+    {
+        output += "raft_peer_channel_state{peer=\"";
+        output += replication_->peer(i);
+        output += "\"} ";
+        output += std::to_string(static_cast<int>(replication_->channelState(i)));
+        output += "\n";
+    }
+
     return output;
 }
\ No newline at end of file
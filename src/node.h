@@ -1,4 +1,5 @@
 #pragma once
+#include "config.h"
 #include "kv_store.h"
 #include "operation.h"
 #include "../rust_wal/src/wal_adapter.h"
@@ -6,10 +7,22 @@
 #include <vector>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <unordered_map>
 
+class ReplicationManager;
+struct FollowerPipeline;
+
+namespace kv
+{
+    class ReplicationPacket;
+}
+
 enum class Role
 {
     FOLLOWER,
@@ -21,24 +34,62 @@ class Node
 {
 public:
     Node(const std::string &wal_file,
-         const std::vector<std::string> &peers);
+         const std::vector<std::string> &peers,
+         const NodeConfig &config = NodeConfig());
+    ~Node();
 
     void start();
 
+    // On success, *index (if given) receives the entry's log index.
     bool replicateAndCommit(const std::string &key,
-                            const std::string &value);
+                            const std::string &value,
+                            int64_t *index = nullptr);
+
+    // MultiPut: every write goes in one log entry, so they commit
+    // together or not at all.
+    bool replicateAndCommit(std::vector<std::pair<std::string, std::string>> batch,
+                            int64_t *index = nullptr);
+
+    // value shares the store's buffer; no bytes are copied.
+    bool get(const std::string &key, ValueRef &value);
+
+    // values[i] is null if keys[i] is absent; see KVStore::multiGet.
+    void multiGet(const std::vector<std::string> &keys,
+                  std::vector<ValueRef> &values);
 
-    bool get(const std::string &key, std::string &value);
+    // Applied entries in [start, end), in key order; see KVStore::scan.
+    void scan(const std::string &start,
+              const std::string &end,
+              size_t limit,
+              std::vector<std::pair<std::string, ValueRef>> &out);
 
-    void recover();
+    // Loads the latest snapshot, if any, then replays the log, reading
+    // its entries in place from the mapped segments.
+    // Returns false if the snapshot on disk is corrupt.
+    bool recover();
 
+    // Term of the entry at index, or -1 if it is not in the log. The
+    // entry the snapshot ends with keeps its term.
+    int64_t termAt(int64_t index) const;
+
+    // Raft's log-matching check: true if our entry at index has the
+    // given term. Everything up to our snapshot is committed, and so
+    // matches any leader's log.
+    bool matchesLog(int64_t index, int64_t term) const;
+
+    // Stores op, replacing anything we hold from its index on. The
+    // caller has already rejected stale leaders by the packet's term; a
+    // leader catching us up sends entries from earlier terms, and they
+    // are stored like any other.
     void appendFromLeader(const Operation &op);
 
-    void applyUpTo(int64_t commit_index);
+    // Applies nothing itself: the apply thread picks the new index up,
+    // so callers never wait on the store.
+    void setCommitIndex(int64_t idx);
 
-    void setCommitIndex(int64_t idx)
+    int64_t commitIndex() const
     {
-        commit_index_.store(idx);
+        return commit_index_.load();
     }
 
     int64_t lastIndex() const
@@ -57,33 +108,130 @@ public:
 
     bool requestVote(int64_t term,
                      int64_t candidate_id,
-                     int64_t last_log_index);
+                     int64_t last_log_index,
+                     int64_t last_log_term);
 
-    void receiveHeartbeat(int64_t term);
+    // Accepts a leader of `term` and resets the election timer. Returns
+    // false if the leader is stale.
+    bool receiveHeartbeat(int64_t term);
 
     std::string metrics();
 
+    // Captures a point-in-time view of the store at last_applied_ and
+    // hands it to the snapshot thread, which writes it and compacts the
+    // log. No-op while a snapshot is already in progress.
     void createSnapshot();
 
-    void installSnapshot(const std::string &data, uint64_t lastIndex, uint64_t lastTerm);
+    // Replaces the store and log with a leader's snapshot chain, written
+    // to snapshotReceivePath(); the file becomes the local snapshot.
+    // Returns false, changing nothing, if an image is corrupt.
+    bool installSnapshot(const std::string &path, uint64_t lastIndex, uint64_t lastTerm);
+
+    std::string snapshotReceivePath() const { return wal_->snapshotReceivePath(); }
+
+    // True if this leader holds a valid lease and the store has applied
+    // everything committed so far, so a local read is linearizable.
+    bool confirmLeaseRead();
+
+    // ReadIndex: records commit_index_, waits for a heartbeat round that
+    // started after that to reach a quorum, then waits for the store to
+    // apply up to it. Concurrent callers share one round.
+    bool confirmReadIndex();
+
+    // Bounded-staleness read on any replica. Waits up to read_timeout_ms
+    // for last_applied_ to reach minAppliedIndex, and requires that we
+    // heard from the leader within maxStalenessMs and applied what it
+    // sent. Zero disables either bound.
+    bool confirmBoundedRead(int64_t minAppliedIndex, int64_t maxStalenessMs);
 
 private:
+    // A client write waiting for the batcher to commit it.
+    struct Proposal
+    {
+        // index and term are set once it is appended; success needs the
+        // entry applied at that index to have that term.
+        Operation op;
+        // The entry's index once committed, or 0 if it failed.
+        std::promise<int64_t> committed;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    // Queues op for the batcher and waits for it to commit.
+    bool propose(Operation op, int64_t *index);
+
+    // Writes a committed entry to the store.
+    void apply(const LogEntry &entry);
+
+    // State-machine thread: applies entries as commit_index_ moves past
+    // last_applied_, wakes readers and the batcher, and snapshots.
+    void applyLoop();
+    void applyUpTo(int64_t commit_index);
+
+    // Wakes the apply thread after commit_index_ moves.
+    void signalApply();
+
+    // Serializes the view createSnapshot captured and writes it.
+    void snapshotLoop();
+
+    // Collapses the snapshot chain into one full image once its deltas
+    // pass the configured bounds. Snapshot thread only.
+    void mergeSnapshots();
+
+    // recovery_threads, with 0 resolved to the core count.
+    size_t recoveryThreads() const;
+
+    void commitLoop();
+    void commitBatch(std::vector<Proposal> &batch);
+    void completePending();
+    void notifyCommit();
+
+    // Each follower gets a ReplicateStream with a sender thread that
+    // keeps up to max_inflight_appends packets outstanding and an ack
+    // thread that reads the replies, so a slow peer never holds up the
+    // others.
+    void replicationLoop(int followerIndex);
+    void ackLoop(int followerIndex);
+    void rewindFollower(int followerIndex, uint64_t generation, int64_t resumeAt);
+    void signalReplication();
+
+    bool buildAppendPacket(int64_t from, kv::ReplicationPacket &packet);
+    bool sendSnapshotToFollower(int followerIndex);
+    void advanceMatchIndex(int followerIndex, int64_t index);
+
     void electionLoop();
     void startElection();
+
+    // While leader, sends a heartbeat to every follower each
+    // heartbeat_interval_ms, or right away after winning an election.
+    void heartbeatLoop();
     void sendHeartbeats();
 
-    bool replicateToFollower(int followerIndex);
+    // Wakes the heartbeat thread to send a round now.
+    void requestHeartbeat();
+
+    // Waits until last_applied_ reaches index, up to read_timeout_ms.
+    bool waitForApplied(int64_t index);
 
+    // Caller holds commit_mutex_.
     void updateCommitIndex();
 
+    NodeConfig config_;
+
     KVStore store_;
     std::unique_ptr<WALAdapter> wal_;
 
     std::vector<std::string> peers_;
 
+    // One persistent channel per peer, shared by every sender thread.
+    std::unique_ptr<ReplicationManager> replication_;
+
+    // nextIndex_[i] is guarded by pipelines_[i]->mutex;
+    // matchIndex_ is guarded by commit_mutex_.
     std::vector<int64_t> nextIndex_;
     std::vector<int64_t> matchIndex_;
 
+    std::vector<std::unique_ptr<FollowerPipeline>> pipelines_;
+
     std::atomic<int64_t> last_index_;
     std::atomic<int64_t> commit_index_;
     std::atomic<int64_t> last_applied_;
@@ -94,10 +242,76 @@ private:
     std::atomic<Role> role_;
 
     std::atomic<bool> running_;
+    // Steady-clock time (ns) the election timer last reset: a packet
+    // from the leader or a vote we granted.
     std::atomic<int64_t> last_heartbeat_time_;
 
+    // Steady-clock time (ns) of the last packet from a current leader,
+    // heartbeat or AppendEntries. Bounds follower read staleness.
+    std::atomic<int64_t> last_leader_contact_;
+
+    // Guards voted_for_ and term/role transitions.
     std::mutex election_mutex_;
 
+    std::mutex heartbeat_mutex_;
+    std::condition_variable heartbeat_cv_;
+    bool heartbeat_now_ = false;
+
+    // Steady-clock deadline (ns) of the current leader lease.
+    std::atomic<int64_t> lease_until_;
+
+    // Index of the no-op we appended on winning the election. Reads wait
+    // until it commits, so entries from earlier terms are visible.
+    std::atomic<int64_t> leader_start_index_;
+
+    // Readers waiting for last_applied_ to reach an index.
+    std::mutex apply_mutex_;
+    std::condition_variable apply_cv_;
+
+    // The apply thread sleeps here until there is committed work.
+    std::mutex apply_queue_mutex_;
+    std::condition_variable apply_queue_cv_;
+
+    // Held while the store and last_applied_ change together: by the
+    // apply thread, and while installing a snapshot. Taken after
+    // snapshot_mutex_ when both are needed.
+    std::mutex state_mutex_;
+
+    // Heartbeat rounds, numbered from 1. ReadIndex waiters sleep on
+    // read_index_cv_ until the round they need is done.
+    std::mutex read_index_mutex_;
+    std::condition_variable read_index_cv_;
+    uint64_t heartbeat_rounds_started_ = 0;
+    uint64_t heartbeat_rounds_done_ = 0;
+    uint64_t heartbeat_rounds_confirmed_ = 0;
+
+    std::mutex proposal_mutex_;
+    std::condition_variable proposal_cv_;
+    std::deque<Proposal> proposals_;
+
+    // Appended, waiting for commit. Batcher thread only.
+    std::deque<Proposal> pending_;
+
+    // Guards the WAL's in-memory log against the follower senders.
+    mutable std::shared_mutex log_mutex_;
+
+    std::mutex commit_mutex_;
+
+    // Background snapshot handed from createSnapshot to snapshotLoop.
+    // snapshot_running_ stays set until it is written.
+    std::mutex snapshot_mutex_;
+    std::condition_variable snapshot_cv_;
+    std::unique_ptr<KVStore::Snapshot> snapshot_;
+    int64_t snapshot_index_ = 0;
+    int64_t snapshot_term_ = 0;
+    bool snapshot_running_ = false;
+
+    // Set when a snapshot fails: the store has stopped tracking the keys
+    // it held, so the next one cannot be a delta.
+    bool snapshot_needs_full_ = false;
+
+    std::atomic<int64_t> snapshots_total_;
+    std::atomic<int64_t> snapshot_merges_total_;
     std::atomic<int64_t> elections_total_;
     std::atomic<int64_t> replication_failures_total_;
 };
\ No newline at end of file
@@ -1,11 +1,43 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <utility>
+#include <vector>
+
+// What a log entry does when applied. Stored with the entry in the WAL
+// and sent with it to followers, so no key or value is ever taken for a
+// marker.
+enum class EntryKind : uint32_t
+{
+    PUT = 0,   // writes key and value
+    BATCH = 1, // MultiPut: writes batch in order; key and value unused
+    NOOP = 2,  // appended by a new leader in its term; writes nothing
+};
 
 struct Operation
 {
     int64_t index;
     int64_t term;
+    EntryKind kind = EntryKind::PUT;
     std::string key;
     std::string value;
+
+    // MultiPut writes, for EntryKind::BATCH.
+    std::vector<std::pair<std::string, std::string>> batch;
+};
+
+// A log entry read in place from the WAL: the views point into its mapped
+// segments and stay valid until the entry is truncated or compacted away,
+// both of which need the node's log lock.
+struct LogEntry
+{
+    int64_t index;
+    int64_t term;
+    EntryKind kind;
+    std::string_view key;
+    std::string_view value;
+
+    // As in Operation.
+    std::vector<std::pair<std::string_view, std::string_view>> batch;
 };
\ No newline at end of file
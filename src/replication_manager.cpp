@@ -1,13 +1,76 @@
 #include "replication_manager.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <thread>
+
+grpc::Status grpc::SerializationTraits<SnapshotChunkRef>::Serialize(
+    const SnapshotChunkRef &chunk,
+    grpc::ByteBuffer *buffer,
+    bool *own_buffer)
+{
+    kv::InstallSnapshotChunk meta;
+    meta.set_last_index(chunk.last_index);
+    meta.set_last_term(chunk.last_term);
+    meta.set_done(chunk.done);
+
+    std::string tail = meta.SerializeAsString();
+
+    if (chunk.size == 0)
+    {
+        grpc::Slice slice(tail);
+        *buffer = grpc::ByteBuffer(&slice, 1);
+        *own_buffer = true;
+        return grpc::Status::OK;
+    }
+
+    // Field 1 (data), length-delimited: tag and varint length, then the
+    // bytes as a slice over the caller's memory. Protobuf accepts fields
+    // in any order, so the rest follows.
+    uint8_t head[1 + 5];
+    head[0] = (1 << 3) | 2;
+    uint8_t *end = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        (uint32_t)chunk.size, head + 1);
+
+    grpc::Slice slices[3] = {
+        grpc::Slice(head, end - head),
+        grpc::Slice(chunk.data, chunk.size, grpc::Slice::STATIC_SLICE),
+        grpc::Slice(tail)};
+
+    *buffer = grpc::ByteBuffer(slices, 3);
+    *own_buffer = true;
+    return grpc::Status::OK;
+}
 
 ReplicationManager::ReplicationManager(
-    const std::vector<std::string> &peers)
+    const std::vector<std::string> &peers,
+    const NodeConfig &config)
+    : rpc_timeout_(config.rpc_timeout_ms),
+      snapshot_chunk_bytes_(config.snapshot_transfer_chunk_bytes),
+      snapshot_bytes_per_sec_(config.snapshot_transfer_bytes_per_sec),
+      snapshot_timeout_(config.snapshot_transfer_timeout_ms),
+      peers_(peers)
 {
+    grpc::ChannelArguments args;
+
+    // Keep idle connections warm and notice dead peers between writes.
+    args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, config.keepalive_time_ms);
+    args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, config.keepalive_timeout_ms);
+    args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+    args.SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+
+    // Reconnect quickly after a peer restarts, backing off while it
+    // stays down.
+    args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, config.reconnect_backoff_min_ms);
+    args.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, config.reconnect_backoff_min_ms);
+    args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, config.reconnect_backoff_max_ms);
+
     for (const auto &peer : peers)
     {
-        auto channel = grpc::CreateChannel(
+        auto channel = grpc::CreateCustomChannel(
             peer,
-            grpc::InsecureChannelCredentials());
+            grpc::InsecureChannelCredentials(),
+            args);
+
+        channels_.push_back(channel);
 
         replication_stubs_.push_back(
             kv::ReplicationService::NewStub(channel));
@@ -17,174 +80,217 @@ ReplicationManager::ReplicationManager(
     }
 }
 
+grpc_connectivity_state ReplicationManager::channelState(size_t peer) const
+{
+    return channels_[peer]->GetState(false);
+}
+
+namespace
+{
+    // One outstanding unary call in a parallel fan-out.
+    template <typename Reply>
+    struct PendingCall
+    {
+        grpc::ClientContext context;
+        grpc::Status status;
+        Reply reply;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<Reply>> reader;
+    };
+
+    // Waits for every call issued on cq; tags are call indices.
+    void drain(grpc::CompletionQueue &cq, size_t outstanding)
+    {
+        void *tag;
+        bool ok;
+
+        while (outstanding > 0 && cq.Next(&tag, &ok))
+            outstanding--;
+    }
+}
+
 int ReplicationManager::replicate(
-    const kv::Operation &op,
-    int64_t commit_index)
+    const std::vector<kv::ReplicationPacket> &packets,
+    std::vector<kv::ReplicationAck> *acks,
+    std::chrono::milliseconds timeout)
 {
-    int success_count = 0;
+    size_t n = replication_stubs_.size();
+    auto deadline = std::chrono::system_clock::now() + timeout;
+
+    grpc::CompletionQueue cq;
+    std::vector<PendingCall<kv::ReplicationAck>> calls(n);
 
-    for (auto &stub : replication_stubs_)
+    for (size_t i = 0; i < n; ++i)
     {
-        kv::ReplicationPacket packet;
+        auto &call = calls[i];
+        call.context.set_deadline(deadline);
+        call.reader = replication_stubs_[i]->AsyncReplicate(
+            &call.context, packets[i], &cq);
+        call.reader->Finish(&call.reply, &call.status, (void *)i);
+    }
 
-        packet.set_commit_index(commit_index);
+    drain(cq, n);
 
-        if (op.index() != 0)
-        {
-            packet.set_from_index(op.index());
-            *packet.add_ops() = op;
-        }
+    int success_count = 0;
 
-        kv::ReplicationAck ack;
-        grpc::ClientContext context;
+    if (acks)
+        acks->assign(n, kv::ReplicationAck());
 
-        grpc::Status status =
-            stub->Replicate(&context, packet, &ack);
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (!calls[i].status.ok())
+            continue;
 
-        if (status.ok() && ack.success())
+        if (calls[i].reply.success())
             success_count++;
+
+        if (acks)
+            (*acks)[i] = calls[i].reply;
     }
 
     return success_count;
 }
 
+std::shared_ptr<ReplicationStream> ReplicationManager::openStream(size_t peer)
+{
+    // No deadline: the stream lives until it breaks. Keepalive on the
+    // channel detects a dead peer.
+    auto s = std::make_shared<ReplicationStream>();
+    s->stream = replication_stubs_[peer]->ReplicateStream(&s->context);
+    return s;
+}
+
 int ReplicationManager::requestVotes(
     int64_t term,
     int64_t candidate_id,
-    int64_t last_log_index)
+    int64_t last_log_index,
+    int64_t last_log_term)
 {
-    int votes = 1; // self vote
+    kv::VoteRequest request;
+    request.set_term(term);
+    request.set_candidate_id(candidate_id);
+    request.set_last_log_index(last_log_index);
+    request.set_last_log_term(last_log_term);
+
+    size_t n = election_stubs_.size();
+    auto deadline = std::chrono::system_clock::now() + rpc_timeout_;
+
+    grpc::CompletionQueue cq;
+    std::vector<PendingCall<kv::VoteResponse>> calls(n);
 
-    for (auto &stub : election_stubs_)
+    for (size_t i = 0; i < n; ++i)
     {
-        kv::VoteRequest request;
-        request.set_term(term);
-        request.set_candidate_id(candidate_id);
-        request.set_last_log_index(last_log_index);
+        auto &call = calls[i];
+        call.context.set_deadline(deadline);
+        call.reader = election_stubs_[i]->AsyncRequestVote(
+            &call.context, request, &cq);
+        call.reader->Finish(&call.reply, &call.status, (void *)i);
+    }
 
-        kv::VoteResponse response;
-        grpc::ClientContext context;
+    drain(cq, n);
 
-        grpc::Status status =
-            stub->RequestVote(&context, request, &response);
+    int votes = 1; // self vote
 
-        if (!status.ok())
+    for (const auto &call : calls)
+    {
+        if (!call.status.ok())
             continue;
 
-        if (response.term() > term)
+        if (call.reply.term() > term)
         {
             // higher term detected
             return -1;
         }
 
-        if (response.vote_granted())
+        if (call.reply.vote_granted())
             votes++;
     }
 
     return votes;
 }
 
-bool ReplicationManager::sendSnapshot(
-    const std::string &peer,
-    const std::string &data,
+bool ReplicationManager::sendSnapshotStream(
+    size_t peer,
+    const std::vector<snapshot_format::Image> &images,
     uint64_t lastIndex,
     uint64_t lastTerm)
 {
-    auto channel =
-        grpc::CreateChannel(peer,
-                            grpc::InsecureChannelCredentials());
-
-    auto stub =
-        kv::ReplicationService::NewStub(channel);
-
-    grpc::ClientContext ctx;
-    kv::InstallSnapshotResponse resp;
-
-    auto writer =
-        stub->InstallSnapshot(&ctx, &resp);
-
-    const size_t CHUNK = 64 * 1024;
-    size_t offset = 0;
-
-    while (offset < data.size())
-    {
-        kv::InstallSnapshotChunk chunk;
-
-        size_t n =
-            std::min(CHUNK, data.size() - offset);
-
-        chunk.set_data(data.data() + offset, n);
-        chunk.set_last_index(lastIndex);
-        chunk.set_last_term(lastTerm);
-        chunk.set_done(false);
+    size_t size = 0;
 
-        writer->Write(chunk);
-        offset += n;
-    }
-
-    kv::InstallSnapshotChunk finalChunk;
-    finalChunk.set_done(true);
-    finalChunk.set_last_index(lastIndex);
-    finalChunk.set_last_term(lastTerm);
+    for (const auto &image : images)
+        size += image.size;
 
-    writer->Write(finalChunk);
-    writer->WritesDone();
-
-    grpc::Status status = writer->Finish();
-
-    return status.ok() && resp.success();
-}
-
-bool ReplicationManager::sendSnapshotStream(
-    const std::string &peer,
-    const std::string &data,
-    uint64_t lastIndex,
-    uint64_t lastTerm)
-{
-    auto channel =
-        grpc::CreateChannel(peer,
-                            grpc::InsecureChannelCredentials());
+    // Without a deadline a follower that stops reading would hold the
+    // stream open forever. Allow for the pacing, then a fixed margin;
+    // past it writes fail and Finish reports DEADLINE_EXCEEDED.
+    auto allowed = snapshot_timeout_;
 
-    std::unique_ptr<kv::ReplicationService::Stub> stub =
-        kv::ReplicationService::NewStub(channel);
+    if (snapshot_bytes_per_sec_ > 0)
+        allowed += std::chrono::milliseconds(size * 1000 / snapshot_bytes_per_sec_);
 
     grpc::ClientContext ctx;
+    ctx.set_deadline(std::chrono::system_clock::now() + allowed);
     kv::InstallSnapshotResponse resp;
 
-    auto writer =
-        stub->InstallSnapshot(&ctx, &resp);
+    // The generated stub only writes kv::InstallSnapshotChunk, so open
+    // the same method with a writer for SnapshotChunkRef.
+    static const grpc::internal::RpcMethod method(
+        "/kv.ReplicationService/InstallSnapshot",
+        grpc::internal::RpcMethod::CLIENT_STREAMING);
 
-    const size_t CHUNK = 64 * 1024;
-    size_t offset = 0;
+    std::unique_ptr<grpc::ClientWriter<SnapshotChunkRef>> writer(
+        grpc::internal::ClientWriterFactory<SnapshotChunkRef>::Create(
+            channels_[peer].get(), method, &ctx, &resp));
 
-    while (offset < data.size())
-    {
-        kv::InstallSnapshotChunk chunk;
+    auto start = std::chrono::steady_clock::now();
+    size_t sent = 0;
 
-        size_t len =
-            std::min(CHUNK,
-                     data.size() - offset);
+    SnapshotChunkRef chunk;
+    chunk.last_index = lastIndex;
+    chunk.last_term = lastTerm;
 
-        chunk.set_data(data.data() + offset, len);
-        chunk.set_last_index(lastIndex);
-        chunk.set_last_term(lastTerm);
-        chunk.set_done(false);
+    // Chunks never span images, so each is one slice of one mapping.
+    for (const auto &image : images)
+    {
+        size_t offset = 0;
 
-        writer->Write(chunk);
+        while (offset < image.size)
+        {
+            chunk.data = image.data + offset;
+            chunk.size = std::min(snapshot_chunk_bytes_, image.size - offset);
+
+            // Write blocks until the transport has taken the chunk, which
+            // HTTP/2 flow control holds back while the follower is behind.
+            if (!writer->Write(chunk))
+                break;
+
+            offset += chunk.size;
+            sent += chunk.size;
+
+            if (snapshot_bytes_per_sec_ > 0)
+            {
+                std::this_thread::sleep_until(
+                    start + std::chrono::microseconds(
+                                sent * 1000000 / snapshot_bytes_per_sec_));
+            }
+        }
 
-        offset += len;
+        if (offset < image.size)
+            break;
     }
 
-    kv::InstallSnapshotChunk finalChunk;
-    finalChunk.set_done(true);
-    finalChunk.set_last_index(lastIndex);
-    finalChunk.set_last_term(lastTerm);
+    if (sent == size)
+    {
+        SnapshotChunkRef finalChunk;
+        finalChunk.last_index = lastIndex;
+        finalChunk.last_term = lastTerm;
+        finalChunk.done = true;
 
-    writer->Write(finalChunk);
+        writer->Write(finalChunk);
+    }
 
     writer->WritesDone();
 
     grpc::Status status = writer->Finish();
 
-    return status.ok() && resp.success();
+    return status.ok() && sent == size && resp.success();
 }
\ No newline at end of file
@@ -1,33 +1,102 @@
 #pragma once
 #include <grpcpp/grpcpp.h>
 #include "kv.grpc.pb.h"
+#include "config.h"
+#include "snapshot_format.h"
+#include <chrono>
 #include <vector>
 #include <string>
 #include <memory>
 
+// A long-lived AppendEntries stream to one peer. One thread may write
+// while another reads; cancel through context to tear it down.
+struct ReplicationStream
+{
+    grpc::ClientContext context;
+    std::unique_ptr<grpc::ClientReaderWriter<kv::ReplicationPacket,
+                                             kv::ReplicationAck>>
+        stream;
+};
+
+// One kv.InstallSnapshotChunk as the leader sends it: data points into
+// the mapped snapshot file and goes on the wire as its own slice, so
+// chunks are never copied into a message. The mapping must outlive the
+// RPC.
+struct SnapshotChunkRef
+{
+    const char *data = nullptr;
+    size_t size = 0;
+    uint64_t last_index = 0;
+    uint64_t last_term = 0;
+    bool done = false;
+};
+
+namespace grpc
+{
+    template <>
+    class SerializationTraits<SnapshotChunkRef>
+    {
+    public:
+        static Status Serialize(const SnapshotChunkRef &chunk,
+                                ByteBuffer *buffer,
+                                bool *own_buffer);
+    };
+}
+
+// Long-lived client side of the cluster: one channel and stub set per
+// peer, created once and reused for every RPC. Peers are addressed by
+// their position in the constructor's list.
 class ReplicationManager
 {
 public:
-    ReplicationManager(const std::vector<std::string> &peers);
+    ReplicationManager(const std::vector<std::string> &peers,
+                       const NodeConfig &config = NodeConfig());
+
+    // Sends packets[i] to peer i, all in parallel. Used for heartbeats,
+    // which carry a per-follower commit index and a shorter deadline. If
+    // acks is given, it receives one reply per peer (default-constructed
+    // when the RPC failed or timed out).
+    int replicate(const std::vector<kv::ReplicationPacket> &packets,
+                  std::vector<kv::ReplicationAck> *acks,
+                  std::chrono::milliseconds timeout);
 
-    int replicate(const kv::Operation &op,
-                  int64_t commit_index);
+    // Opens a ReplicateStream to a single peer.
+    std::shared_ptr<ReplicationStream> openStream(size_t peer);
 
     int requestVotes(int64_t term,
                      int64_t candidate_id,
-                     int64_t last_log_index);
+                     int64_t last_log_index,
+                     int64_t last_log_term);
 
-    bool sendSnapshot(const std::string &peer,
-                      const std::string &data,
-                      uint64_t lastIndex,
-                      uint64_t lastTerm);
-
-    bool sendSnapshotStream(const std::string &peer,
-                            const std::string &data,
+    // Streams a snapshot chain to a peer, its images back to back, in
+    // snapshot_transfer_chunk_bytes chunks straight from their memory
+    // (normally mapped files), paced to snapshot_transfer_bytes_per_sec.
+    // Each chunk is written only once the transport has taken the
+    // previous one, so a slow follower holds back the sender instead of
+    // queueing the chain in memory. Returns false if the stream misses
+    // its deadline (see snapshot_transfer_timeout_ms).
+    bool sendSnapshotStream(size_t peer,
+                            const std::vector<snapshot_format::Image> &images,
                             uint64_t lastIndex,
                             uint64_t lastTerm);
 
+    size_t size() const { return channels_.size(); }
+
+    const std::string &peer(size_t i) const { return peers_[i]; }
+
+    // Current connectivity state of a peer's channel, without
+    // triggering a connection attempt.
+    grpc_connectivity_state channelState(size_t peer) const;
+
 private:
+    std::chrono::milliseconds rpc_timeout_;
+    size_t snapshot_chunk_bytes_;
+    size_t snapshot_bytes_per_sec_;
+    std::chrono::milliseconds snapshot_timeout_;
+
+    std::vector<std::string> peers_;
+    std::vector<std::shared_ptr<grpc::Channel>> channels_;
+
     std::vector<std::unique_ptr<kv::ReplicationService::Stub>> replication_stubs_;
     std::vector<std::unique_ptr<kv::ElectionService::Stub>> election_stubs_;
 };
\ No newline at end of file
@@ -1,12 +1,188 @@
 #include "rpc_server.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 
 /* ===============================
    KV SERVICE
 =================================*/
 
+namespace
+{
+    void appendVarint(std::string &out, uint64_t n)
+    {
+        for (;; n >>= 7)
+        {
+            if (n < 0x80)
+            {
+                out.push_back(static_cast<char>(n));
+                return;
+            }
+            out.push_back(static_cast<char>((n & 0x7f) | 0x80));
+        }
+    }
+
+    size_t varintSize(uint64_t n)
+    {
+        size_t size = 1;
+        for (; n >= 0x80; n >>= 7)
+            size++;
+        return size;
+    }
+
+    // The value's bytes, in a slice that holds a buffer reference.
+    grpc::Slice valueSlice(ValueRef value)
+    {
+        size_t size = value.size();
+        ValueBuffer *held = value.release();
+
+        return grpc::Slice(const_cast<char *>(held->data()),
+                           size,
+                           [](void *p)
+                           { static_cast<ValueBuffer *>(p)->unref(); },
+                           held);
+    }
+}
+
+grpc::Status grpc::SerializationTraits<GetReply>::Serialize(
+    const GetReply &reply,
+    grpc::ByteBuffer *buffer,
+    bool *own_buffer)
+{
+    std::string head = reply.header.SerializeAsString();
+
+    if (!reply.value)
+    {
+        grpc::Slice slice(head);
+        *buffer = grpc::ByteBuffer(&slice, 1);
+        *own_buffer = true;
+        return grpc::Status::OK;
+    }
+
+    // Field 2 (value), length-delimited: tag, varint length, then the
+    // bytes themselves.
+    head.push_back(static_cast<char>((2 << 3) | 2));
+    appendVarint(head, reply.value.size());
+
+    grpc::Slice slices[2] = {grpc::Slice(head), valueSlice(reply.value)};
+
+    *buffer = grpc::ByteBuffer(slices, 2);
+    *own_buffer = true;
+    return grpc::Status::OK;
+}
+
+grpc::Status grpc::SerializationTraits<MultiGetReply>::Serialize(
+    const MultiGetReply &reply,
+    grpc::ByteBuffer *buffer,
+    bool *own_buffer)
+{
+    // Each result is field 1 of the response, a MultiGetResult holding
+    // found (field 1) and value (field 2). Framing bytes collect in
+    // `pending` and go out as one slice before each value slice.
+    std::vector<grpc::Slice> slices;
+    std::string pending = reply.header.SerializeAsString();
+
+    for (const ValueRef &value : reply.values)
+    {
+        pending.push_back(static_cast<char>((1 << 3) | 2));
+
+        if (!value)
+        {
+            pending.push_back(0);
+            continue;
+        }
+
+        appendVarint(pending, 2 + 1 + varintSize(value.size()) + value.size());
+        pending.push_back(static_cast<char>((1 << 3) | 0));
+        pending.push_back(1);
+        pending.push_back(static_cast<char>((2 << 3) | 2));
+        appendVarint(pending, value.size());
+
+        slices.emplace_back(pending);
+        pending.clear();
+        slices.push_back(valueSlice(value));
+    }
+
+    if (!pending.empty())
+        slices.emplace_back(pending);
+
+    *buffer = grpc::ByteBuffer(slices.data(), slices.size());
+    *own_buffer = true;
+    return grpc::Status::OK;
+}
+
 KVServiceImpl::KVServiceImpl(Node *node)
-    : node_(node) {}
+    : node_(node)
+{
+    using grpc::internal::RpcMethod;
+    using grpc::internal::RpcMethodHandler;
+    using grpc::internal::RpcServiceMethod;
+    using grpc::internal::ServerStreamingHandler;
+
+    AddMethod(new RpcServiceMethod(
+        "/kv.KVService/Put",
+        RpcMethod::NORMAL_RPC,
+        new RpcMethodHandler<KVServiceImpl, kv::PutRequest, kv::PutResponse,
+                             grpc::protobuf::MessageLite,
+                             grpc::protobuf::MessageLite>(
+            [](KVServiceImpl *service,
+               grpc::ServerContext *context,
+               const kv::PutRequest *request,
+               kv::PutResponse *response)
+            { return service->Put(context, request, response); },
+            this)));
+
+    AddMethod(new RpcServiceMethod(
+        "/kv.KVService/Get",
+        RpcMethod::NORMAL_RPC,
+        new RpcMethodHandler<KVServiceImpl, kv::GetRequest, GetReply,
+                             grpc::protobuf::MessageLite, GetReply>(
+            [](KVServiceImpl *service,
+               grpc::ServerContext *context,
+               const kv::GetRequest *request,
+               GetReply *reply)
+            { return service->Get(context, request, reply); },
+            this)));
+
+    AddMethod(new RpcServiceMethod(
+        "/kv.KVService/MultiPut",
+        RpcMethod::NORMAL_RPC,
+        new RpcMethodHandler<KVServiceImpl, kv::MultiPutRequest, kv::PutResponse,
+                             grpc::protobuf::MessageLite,
+                             grpc::protobuf::MessageLite>(
+            [](KVServiceImpl *service,
+               grpc::ServerContext *context,
+               const kv::MultiPutRequest *request,
+               kv::PutResponse *response)
+            { return service->MultiPut(context, request, response); },
+            this)));
+
+    AddMethod(new RpcServiceMethod(
+        "/kv.KVService/MultiGet",
+        RpcMethod::NORMAL_RPC,
+        new RpcMethodHandler<KVServiceImpl, kv::MultiGetRequest, MultiGetReply,
+                             grpc::protobuf::MessageLite, MultiGetReply>(
+            [](KVServiceImpl *service,
+               grpc::ServerContext *context,
+               const kv::MultiGetRequest *request,
+               MultiGetReply *reply)
+            { return service->MultiGet(context, request, reply); },
+            this)));
+
+    AddMethod(new RpcServiceMethod(
+        "/kv.KVService/Scan",
+        RpcMethod::SERVER_STREAMING,
+        new ServerStreamingHandler<KVServiceImpl, kv::ScanRequest,
+                                   kv::ScanResponse>(
+            [](KVServiceImpl *service,
+               grpc::ServerContext *context,
+               const kv::ScanRequest *request,
+               grpc::ServerWriter<kv::ScanResponse> *writer)
+            { return service->Scan(context, request, writer); },
+            this)));
+}
 
 grpc::Status KVServiceImpl::Put(
     grpc::ServerContext *,
@@ -20,27 +196,178 @@ grpc::Status KVServiceImpl::Put(
         return grpc::Status::OK;
     }
 
+    int64_t index = 0;
     bool success = node_->replicateAndCommit(
         request->key(),
-        request->value());
+        request->value(),
+        &index);
 
     response->set_success(success);
+    response->set_index(index);
 
     return grpc::Status::OK;
 }
 
+bool KVServiceImpl::confirmRead(kv::ReadConsistency consistency,
+                                int64_t minAppliedIndex,
+                                int64_t maxStalenessMs)
+{
+    switch (consistency)
+    {
+    case kv::READ_LEASE:
+        return node_->confirmLeaseRead();
+    case kv::READ_INDEX:
+        return node_->confirmReadIndex();
+    default:
+        return node_->confirmBoundedRead(minAppliedIndex, maxStalenessMs);
+    }
+}
+
 grpc::Status KVServiceImpl::Get(
     grpc::ServerContext *,
     const kv::GetRequest *request,
-    kv::GetResponse *response)
+    GetReply *reply)
 {
-    std::string value;
-    bool found = node_->get(request->key(), value);
+    kv::GetResponse *response = &reply->header;
+
+    if (!confirmRead(request->consistency(),
+                     request->min_applied_index(),
+                     request->max_staleness_ms()))
+    {
+        response->set_success(false);
+        response->set_leader_target("UNKNOWN");
+        return grpc::Status::OK;
+    }
+
+    bool found = node_->get(request->key(), reply->value);
 
+    response->set_success(true);
     response->set_found(found);
 
-    if (found)
-        response->set_value(value);
+    return grpc::Status::OK;
+}
+
+grpc::Status KVServiceImpl::MultiPut(
+    grpc::ServerContext *,
+    const kv::MultiPutRequest *request,
+    kv::PutResponse *response)
+{
+    if (node_->role() != Role::LEADER)
+    {
+        response->set_success(false);
+        response->set_leader_target("UNKNOWN");
+        return grpc::Status::OK;
+    }
+
+    // Nothing to log.
+    if (request->entries_size() == 0)
+    {
+        response->set_success(true);
+        return grpc::Status::OK;
+    }
+
+    std::vector<std::pair<std::string, std::string>> batch;
+    batch.reserve(request->entries_size());
+
+    for (const auto &entry : request->entries())
+        batch.emplace_back(entry.key(), entry.value());
+
+    int64_t index = 0;
+    bool success = node_->replicateAndCommit(std::move(batch), &index);
+
+    response->set_success(success);
+    response->set_index(index);
+
+    return grpc::Status::OK;
+}
+
+grpc::Status KVServiceImpl::MultiGet(
+    grpc::ServerContext *,
+    const kv::MultiGetRequest *request,
+    MultiGetReply *reply)
+{
+    kv::MultiGetResponse *response = &reply->header;
+
+    if (!confirmRead(request->consistency(),
+                     request->min_applied_index(),
+                     request->max_staleness_ms()))
+    {
+        response->set_success(false);
+        response->set_leader_target("UNKNOWN");
+        return grpc::Status::OK;
+    }
+
+    std::vector<std::string> keys(request->keys().begin(),
+                                  request->keys().end());
+    node_->multiGet(keys, reply->values);
+
+    response->set_success(true);
+
+    return grpc::Status::OK;
+}
+
+grpc::Status KVServiceImpl::Scan(
+    grpc::ServerContext *context,
+    const kv::ScanRequest *request,
+    grpc::ServerWriter<kv::ScanResponse> *writer)
+{
+    // Entries per message. Each batch is one short hold of the ordered
+    // index's read lock.
+    const size_t SCAN_BATCH = 256;
+
+    if (!confirmRead(request->consistency(),
+                     request->min_applied_index(),
+                     request->max_staleness_ms()))
+    {
+        kv::ScanResponse response;
+        response.set_success(false);
+        response.set_leader_target("UNKNOWN");
+        writer->Write(response);
+        return grpc::Status::OK;
+    }
+
+    std::string from = request->page_token().empty() ? request->start_key()
+                                                     : request->page_token();
+    size_t remaining = request->limit() ? request->limit() : SIZE_MAX;
+    std::vector<std::pair<std::string, ValueRef>> batch;
+
+    while (!context->IsCancelled())
+    {
+        // One extra entry tells us whether to keep going, and where from.
+        size_t want = std::min(SCAN_BATCH, remaining);
+        batch.clear();
+        node_->scan(from, request->end_key(), want + 1, batch);
+
+        bool more = batch.size() > want;
+        size_t count = std::min(batch.size(), want);
+
+        kv::ScanResponse response;
+        response.set_success(true);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            kv::KeyValue *entry = response.add_entries();
+            entry->set_key(batch[i].first);
+            entry->set_value(batch[i].second.data(), batch[i].second.size());
+        }
+
+        remaining -= count;
+
+        if (more)
+            from = batch[want].first;
+
+        if (!more || remaining == 0)
+        {
+            if (more)
+                response.set_next_page_token(from);
+
+            writer->WriteLast(response, grpc::WriteOptions());
+            break;
+        }
+
+        if (!writer->Write(response))
+            break;
+    }
 
     return grpc::Status::OK;
 }
@@ -57,51 +384,116 @@ grpc::Status ReplicationServiceImpl::Replicate(
     const kv::ReplicationPacket *request,
     kv::ReplicationAck *response)
 {
-    // Heartbeat
+    // A pipelining leader can have several unary packets in flight, and
+    // the server may hand them to us out of order. Give an earlier packet
+    // a moment to land before reporting a gap.
+    appendEntries(*request, response, std::chrono::milliseconds(50));
+
+    return grpc::Status::OK;
+}
+
+grpc::Status ReplicationServiceImpl::ReplicateStream(
+    grpc::ServerContext *,
+    grpc::ServerReaderWriter<kv::ReplicationAck, kv::ReplicationPacket> *stream)
+{
+    // Packets on one stream arrive in order, so a gap is real.
+    kv::ReplicationPacket packet;
+
+    while (stream->Read(&packet))
+    {
+        kv::ReplicationAck ack;
+        appendEntries(packet, &ack, std::chrono::milliseconds(0));
+
+        if (!stream->Write(ack))
+            break;
+    }
+
+    return grpc::Status::OK;
+}
+
+void ReplicationServiceImpl::appendEntries(
+    const kv::ReplicationPacket &packet,
+    kv::ReplicationAck *response,
+    std::chrono::milliseconds reorderWait)
+{
+    const kv::ReplicationPacket *request = &packet;
+
+    // Outdated leader. Anything else resets our election timer.
+    if (!node_->receiveHeartbeat(request->term()))
+    {
+        response->set_success(false);
+        response->set_term(node_->currentTerm());
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(append_mutex_);
+
+    // Heartbeat: the leader caps commit_index at what we share with it,
+    // so apply up to there. Never move commit backwards.
     if (request->ops_size() == 0)
     {
-        node_->receiveHeartbeat(request->term());
+        if (request->commit_index() > node_->commitIndex())
+            node_->setCommitIndex(request->commit_index());
+
         response->set_success(true);
+        response->set_last_index(node_->lastIndex());
         response->set_term(node_->currentTerm());
-        return grpc::Status::OK;
+        return;
     }
 
-    // Outdated leader
-    if (request->term() < node_->currentTerm())
+    int64_t prev = request->prev_log_index();
+
+    append_cv_.wait_for(lock, reorderWait, [&]
+                        { return prev <= node_->lastIndex(); });
+
+    // Log matching: the batch extends our log only if we hold the entry
+    // before it, with the leader's term. A gap or a conflict sends the
+    // leader back to the last entry that may still match.
+    if (!node_->matchesLog(prev, request->prev_log_term()))
     {
         response->set_success(false);
+        response->set_last_index(std::min(node_->lastIndex(), prev - 1));
         response->set_term(node_->currentTerm());
-        return grpc::Status::OK;
+        return;
     }
 
-    node_->updateTerm(request->term());
-
     for (const auto &op : request->ops())
     {
-        if (op.index() != node_->lastIndex() + 1)
-        {
-            response->set_success(false);
-            response->set_term(node_->currentTerm());
-            return grpc::Status::OK;
-        }
+        // Batches may overlap what we already hold after a backtrack.
+        // A conflicting term falls through to appendFromLeader, which
+        // truncates the divergent suffix.
+        if (op.index() <= node_->lastIndex() &&
+            node_->matchesLog(op.index(), op.term()))
+            continue;
 
         Operation local_op;
         local_op.index = op.index();
         local_op.term = op.term();
+        local_op.kind = (EntryKind)op.kind();
         local_op.key = op.key();
         local_op.value = op.value();
 
+        for (const auto &write : op.batch())
+            local_op.batch.emplace_back(write.key(), write.value());
+
         node_->appendFromLeader(local_op);
     }
 
-    node_->setCommitIndex(request->commit_index());
-    node_->applyUpTo(request->commit_index());
+    // The packet vouches for our log only up to its last entry; past it
+    // we may still hold a divergent suffix. Never move commit backwards.
+    // The apply thread catches up; the ack doesn't wait for it.
+    int64_t commit = std::min(request->commit_index(),
+                              request->ops(request->ops_size() - 1).index());
+
+    if (commit > node_->commitIndex())
+        node_->setCommitIndex(commit);
+
+    lock.unlock();
+    append_cv_.notify_all();
 
     response->set_success(true);
     response->set_last_index(node_->lastIndex());
     response->set_term(node_->currentTerm());
-
-    return grpc::Status::OK;
 }
 
 /* ===============================
@@ -113,29 +505,43 @@ grpc::Status ReplicationServiceImpl::InstallSnapshot(
     grpc::ServerReader<kv::InstallSnapshotChunk> *reader,
     kv::InstallSnapshotResponse *response)
 {
-    std::string data;
+    // One transfer at a time: they share the receive file.
+    std::lock_guard<std::mutex> lock(install_mutex_);
+
+    // Chunks go to disk as they arrive, so only one is ever in memory.
+    std::string path = node_->snapshotReceivePath();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+
     uint64_t lastIndex = 0;
     uint64_t lastTerm = 0;
+    bool done = false;
 
     kv::InstallSnapshotChunk chunk;
 
-    while (reader->Read(&chunk))
+    while (out && reader->Read(&chunk))
     {
+        lastIndex = chunk.last_index();
+        lastTerm = chunk.last_term();
+
         if (chunk.done())
         {
-            lastIndex = chunk.last_index();
-            lastTerm = chunk.last_term();
+            done = true;
             break;
         }
 
-        data.append(chunk.data());
-        lastIndex = chunk.last_index();
-        lastTerm = chunk.last_term();
+        out.write(chunk.data().data(), chunk.data().size());
     }
 
-    node_->installSnapshot(data, lastIndex, lastTerm);
+    out.close();
 
-    response->set_success(true);
+    // A transfer cut short is dropped; the leader starts over.
+    bool installed = done && out &&
+                     node_->installSnapshot(path, lastIndex, lastTerm);
+
+    if (!installed)
+        std::remove(path.c_str());
+
+    response->set_success(installed);
     return grpc::Status::OK;
 }
 
@@ -151,12 +557,11 @@ grpc::Status ElectionServiceImpl::RequestVote(
     const kv::VoteRequest *request,
     kv::VoteResponse *response)
 {
-    node_->updateTerm(request->term());
-
     bool granted = node_->requestVote(
         request->term(),
         request->candidate_id(),
-        request->last_log_index());
+        request->last_log_index(),
+        request->last_log_term());
 
     response->set_term(node_->currentTerm());
     response->set_vote_granted(granted);
@@ -2,21 +2,83 @@
 #include <grpcpp/grpcpp.h>
 #include "kv.grpc.pb.h"
 #include "node.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 
-class KVServiceImpl final : public kv::KVService::Service
+// kv.GetResponse as the server sends it. The value stays a reference
+// to the store's buffer and goes on the wire as its own slice, so a Get
+// never copies the value bytes. Encodes the same message clients decode
+// with the generated stubs.
+struct GetReply
+{
+    kv::GetResponse header; // every field except value
+    ValueRef value;
+};
+
+// kv.MultiGetResponse as the server sends it; like GetReply, each found
+// value goes on the wire as a slice of the store's buffer.
+struct MultiGetReply
+{
+    kv::MultiGetResponse header; // success and leader_target
+    std::vector<ValueRef> values; // one per key, null if absent
+};
+
+namespace grpc
+{
+    template <>
+    class SerializationTraits<GetReply>
+    {
+    public:
+        static Status Serialize(const GetReply &reply,
+                                ByteBuffer *buffer,
+                                bool *own_buffer);
+    };
+
+    template <>
+    class SerializationTraits<MultiGetReply>
+    {
+    public:
+        static Status Serialize(const MultiGetReply &reply,
+                                ByteBuffer *buffer,
+                                bool *own_buffer);
+    };
+}
+
+// Registers kv.KVService by hand rather than deriving from the generated
+// service, so Get and MultiGet can answer with zero-copy replies.
+class KVServiceImpl final : public grpc::Service
 {
 public:
     KVServiceImpl(Node *node);
 
     grpc::Status Put(grpc::ServerContext *context,
                      const kv::PutRequest *request,
-                     kv::PutResponse *response) override;
+                     kv::PutResponse *response);
 
     grpc::Status Get(grpc::ServerContext *context,
                      const kv::GetRequest *request,
-                     kv::GetResponse *response) override;
+                     GetReply *reply);
+
+    grpc::Status MultiPut(grpc::ServerContext *context,
+                          const kv::MultiPutRequest *request,
+                          kv::PutResponse *response);
+
+    grpc::Status MultiGet(grpc::ServerContext *context,
+                          const kv::MultiGetRequest *request,
+                          MultiGetReply *reply);
+
+    grpc::Status Scan(grpc::ServerContext *context,
+                      const kv::ScanRequest *request,
+                      grpc::ServerWriter<kv::ScanResponse> *writer);
 
 private:
+    // Whether this node may serve a read at the requested consistency,
+    // waiting for it where the mode allows.
+    bool confirmRead(kv::ReadConsistency consistency,
+                     int64_t minAppliedIndex,
+                     int64_t maxStalenessMs);
+
     Node *node_;
 };
 
@@ -30,13 +92,30 @@ public:
         const kv::ReplicationPacket *request,
         kv::ReplicationAck *response) override;
 
+    grpc::Status ReplicateStream(
+        grpc::ServerContext *context,
+        grpc::ServerReaderWriter<kv::ReplicationAck, kv::ReplicationPacket> *stream) override;
+
     grpc::Status InstallSnapshot(
         grpc::ServerContext *,
         grpc::ServerReader<kv::InstallSnapshotChunk> *,
         kv::InstallSnapshotResponse *) override;
 
 private:
+    // Shared by the unary and streaming paths.
+    void appendEntries(const kv::ReplicationPacket &request,
+                       kv::ReplicationAck *response,
+                       std::chrono::milliseconds reorderWait);
+
     Node *node_;
+
+    // Serializes appends; lets pipelined packets that arrive out of
+    // order wait for the one ahead of them.
+    std::mutex append_mutex_;
+    std::condition_variable append_cv_;
+
+    // Held for a whole InstallSnapshot transfer.
+    std::mutex install_mutex_;
 };
 
 class ElectionServiceImpl final : public kv::ElectionService::Service
@@ -0,0 +1,107 @@
+#include "slab_allocator.h"
+#include <algorithm>
+#include <new>
+
+SlabAllocator &SlabAllocator::global()
+{
+    static SlabAllocator *allocator = new SlabAllocator();
+    return *allocator;
+}
+
+SlabAllocator::SlabAllocator()
+{
+    for (size_t size = 16; size <= 256; size += 16)
+        class_sizes_.push_back(size);
+
+    for (size_t base = 256; base < MAX_BLOCK; base *= 2)
+    {
+        for (size_t step = 1; step <= 4; ++step)
+            class_sizes_.push_back(base + step * base / 4);
+    }
+
+    classes_.reset(new SizeClass[class_sizes_.size()]);
+
+    for (size_t i = 0; i < class_sizes_.size(); ++i)
+        classes_[i].block = class_sizes_[i];
+}
+
+int SlabAllocator::classFor(size_t size) const
+{
+    if (size > MAX_BLOCK)
+        return -1;
+
+    if (size <= 256)
+        return size == 0 ? 0 : (int)((size + 15) / 16) - 1;
+
+    auto it = std::lower_bound(class_sizes_.begin(), class_sizes_.end(), size);
+    return (int)(it - class_sizes_.begin());
+}
+
+void *SlabAllocator::allocate(size_t size)
+{
+    int index = classFor(size);
+
+    if (index < 0)
+    {
+        reserved_bytes_ += size;
+        used_bytes_ += size;
+        return ::operator new(size);
+    }
+
+    SizeClass &sc = classes_[index];
+    std::lock_guard<std::mutex> lock(sc.mutex);
+
+    used_bytes_ += sc.block;
+
+    if (sc.free_list)
+    {
+        FreeBlock *block = sc.free_list;
+        sc.free_list = block->next;
+        return block;
+    }
+
+    if (sc.bump + sc.block > sc.bump_end)
+    {
+        char *slab = new char[SLAB_BYTES];
+        {
+            std::lock_guard<std::mutex> slabs_lock(slabs_mutex_);
+            slabs_.emplace_back(slab);
+        }
+        reserved_bytes_ += SLAB_BYTES;
+
+        // A slab's tail shorter than one block is left unused.
+        sc.bump = slab;
+        sc.bump_end = slab + SLAB_BYTES;
+    }
+
+    void *block = sc.bump;
+    sc.bump += sc.block;
+    return block;
+}
+
+void SlabAllocator::deallocate(void *ptr, size_t size)
+{
+    int index = classFor(size);
+
+    if (index < 0)
+    {
+        reserved_bytes_ -= size;
+        used_bytes_ -= size;
+        ::operator delete(ptr);
+        return;
+    }
+
+    SizeClass &sc = classes_[index];
+    std::lock_guard<std::mutex> lock(sc.mutex);
+
+    FreeBlock *block = static_cast<FreeBlock *>(ptr);
+    block->next = sc.free_list;
+    sc.free_list = block;
+
+    used_bytes_ -= sc.block;
+}
+
+SlabAllocator::Stats SlabAllocator::stats() const
+{
+    return {reserved_bytes_.load(), used_bytes_.load()};
+}
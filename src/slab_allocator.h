@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Size-class slab allocator for KVStore keys and values.
+//
+// Requests up to MAX_BLOCK bytes are rounded up to a size class (16-byte
+// steps to 256, then four steps per power of two) and carved out of
+// 256KB slabs, with a free list per class. Freed blocks are reused by
+// their class; slabs are never returned. Larger requests go to the heap.
+// allocate() and deallocate() are thread-safe: values are freed by
+// whichever gRPC thread drops the last reference.
+class SlabAllocator
+{
+public:
+    struct Stats
+    {
+        size_t reserved_bytes; // slabs plus large blocks
+        size_t used_bytes;     // blocks handed out, at class size
+    };
+
+    // Shared by every KVStore; a value can outlive the store that
+    // created it while a Get response still holds it.
+    static SlabAllocator &global();
+
+    void *allocate(size_t size);
+    void deallocate(void *ptr, size_t size);
+
+    Stats stats() const;
+
+private:
+    SlabAllocator();
+
+    static constexpr size_t SLAB_BYTES = 256 * 1024;
+    static constexpr size_t MAX_BLOCK = 16 * 1024;
+
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    struct alignas(64) SizeClass
+    {
+        std::mutex mutex;
+        size_t block = 0;
+        FreeBlock *free_list = nullptr;
+        char *bump = nullptr;
+        char *bump_end = nullptr;
+    };
+
+    // Index of the smallest class that fits size, or -1 for the heap.
+    int classFor(size_t size) const;
+
+    std::vector<size_t> class_sizes_;
+    std::unique_ptr<SizeClass[]> classes_;
+
+    std::mutex slabs_mutex_;
+    std::vector<std::unique_ptr<char[]>> slabs_;
+
+    std::atomic<size_t> reserved_bytes_{0};
+    std::atomic<size_t> used_bytes_{0};
+};
@@ -0,0 +1,388 @@
+#include "snapshot_format.h"
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+namespace snapshot_format
+{
+    namespace
+    {
+        const uint32_t POLY = 0x82f63b78; // reflected Castagnoli
+
+        struct Table
+        {
+            uint32_t entries[256];
+
+            Table()
+            {
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    uint32_t crc = i;
+                    for (int bit = 0; bit < 8; ++bit)
+                        crc = (crc >> 1) ^ (POLY & (0u - (crc & 1)));
+                    entries[i] = crc;
+                }
+            }
+        };
+
+        uint32_t crcSoftware(uint32_t crc, const uint8_t *p, size_t size)
+        {
+            static const Table table;
+
+            for (size_t i = 0; i < size; ++i)
+                crc = table.entries[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+            return crc;
+        }
+
+#if defined(__x86_64__)
+        __attribute__((target("sse4.2")))
+        uint32_t crcHardware(uint32_t crc, const uint8_t *p, size_t size)
+        {
+            uint64_t c = crc;
+
+            for (; size >= 8; p += 8, size -= 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, p, 8);
+                c = _mm_crc32_u64(c, word);
+            }
+
+            uint32_t c32 = (uint32_t)c;
+            for (; size > 0; ++p, --size)
+                c32 = _mm_crc32_u8(c32, *p);
+            return c32;
+        }
+
+        const bool HAS_SSE42 = __builtin_cpu_supports("sse4.2");
+#endif
+
+        // Calls fn(key, value) for each record of image, in order. False
+        // if the records don't add up to what the header says.
+        template <typename Fn>
+        bool forEachRecord(const Image &image, Fn fn)
+        {
+            const char *p = image.data + HEADER_BYTES;
+            const char *end = p + recordBytes(image.header);
+            uint64_t records = 0;
+
+            while ((size_t)(end - p) >= RECORD_HEADER_BYTES)
+            {
+                size_t keySize = getU32(p);
+                size_t valueSize = getU32(p + 4);
+                p += RECORD_HEADER_BYTES;
+
+                if ((size_t)(end - p) < keySize + valueSize)
+                    return false;
+
+                fn(std::string_view(p, keySize),
+                   std::string_view(p + keySize, valueSize));
+
+                p += keySize + valueSize;
+                records++;
+            }
+
+            return p == end && records == image.header.records;
+        }
+
+        bool appendRecord(ChunkWriter &out, std::string_view key,
+                          std::string_view value)
+        {
+            char lengths[RECORD_HEADER_BYTES];
+            putU32(lengths, (uint32_t)key.size());
+            putU32(lengths + 4, (uint32_t)value.size());
+
+            return out.append(lengths, sizeof(lengths)) &&
+                   out.append(key.data(), key.size()) &&
+                   out.append(value.data(), value.size());
+        }
+    }
+
+    uint32_t crc32c(uint32_t crc, const void *data, size_t size)
+    {
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        crc = ~crc;
+
+#if defined(__x86_64__)
+        if (HAS_SSE42)
+            return ~crcHardware(crc, p, size);
+#endif
+
+        return ~crcSoftware(crc, p, size);
+    }
+
+    void encodeHeader(const Header &header, char out[HEADER_BYTES])
+    {
+        std::memcpy(out, MAGIC, sizeof(MAGIC));
+        putU32(out + 8, VERSION);
+        putU32(out + 12, (header.delta ? FLAG_DELTA : 0) |
+                             (header.sections ? FLAG_SECTIONS : 0));
+        putU64(out + 16, header.last_index);
+        putU64(out + 24, header.last_term);
+        putU64(out + 32, header.records);
+        putU64(out + 40, header.data_bytes);
+    }
+
+    bool decodeHeader(const char *data, size_t size, Header &header)
+    {
+        if (size < HEADER_BYTES + TRAILER_BYTES ||
+            std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0 ||
+            getU32(data + 8) != VERSION ||
+            (getU32(data + 12) & ~(FLAG_DELTA | FLAG_SECTIONS)) != 0)
+            return false;
+
+        uint32_t flags = getU32(data + 12);
+
+        header.delta = (flags & FLAG_DELTA) != 0;
+        header.last_index = getU64(data + 16);
+        header.last_term = getU64(data + 24);
+        header.records = getU64(data + 32);
+        header.data_bytes = getU64(data + 40);
+        header.sections = 0;
+
+        if (header.data_bytes != size - HEADER_BYTES - TRAILER_BYTES)
+            return false;
+
+        if (!(flags & FLAG_SECTIONS))
+            return true;
+
+        // The section count is the table's last field.
+        if (header.data_bytes < 4)
+            return false;
+
+        header.sections = getU32(data + HEADER_BYTES + header.data_bytes - 4);
+
+        return header.sections > 0 &&
+               header.data_bytes >= sectionTableBytes(header.sections);
+    }
+
+    std::string encodeSections(const std::vector<uint64_t> &offsets)
+    {
+        std::string out(sectionTableBytes((uint32_t)offsets.size()), '\0');
+
+        for (size_t i = 0; i < offsets.size(); ++i)
+            putU64(&out[8 * i], offsets[i]);
+
+        if (!offsets.empty())
+            putU32(&out[8 * offsets.size()], (uint32_t)offsets.size());
+
+        return out;
+    }
+
+    bool verifyChecksum(const char *data, size_t size)
+    {
+        if (size < TRAILER_BYTES)
+            return false;
+
+        size_t body = size - TRAILER_BYTES;
+        return crc32c(0, data, body) == getU32(data + body);
+    }
+
+    bool split(const char *data, size_t size, std::vector<Image> &images)
+    {
+        size_t start = images.size();
+
+        while (size > 0)
+        {
+            if (size < HEADER_BYTES + TRAILER_BYTES)
+                return false;
+
+            uint64_t dataBytes = getU64(data + 40);
+
+            if (dataBytes > size - HEADER_BYTES - TRAILER_BYTES)
+                return false;
+
+            Image image{data, (size_t)dataBytes + HEADER_BYTES + TRAILER_BYTES, {}};
+
+            if (!decodeHeader(image.data, image.size, image.header))
+                return false;
+
+            images.push_back(image);
+            data += image.size;
+            size -= image.size;
+        }
+
+        return images.size() > start;
+    }
+
+    bool isChain(const std::vector<Image> &images)
+    {
+        if (images.empty() || images.front().header.delta)
+            return false;
+
+        for (size_t i = 1; i < images.size(); ++i)
+        {
+            if (!images[i].header.delta ||
+                images[i].header.last_index <= images[i - 1].header.last_index)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool sections(const Image &image, std::vector<Section> &out)
+    {
+        const char *records = image.data + HEADER_BYTES;
+        uint64_t size = recordBytes(image.header);
+
+        if (image.header.sections == 0)
+        {
+            out.push_back({records, records + size});
+            return true;
+        }
+
+        const char *table = records + size;
+        uint64_t prev = 0;
+
+        for (uint32_t i = 0; i < image.header.sections; ++i)
+        {
+            uint64_t offset = getU64(table + 8 * i);
+            uint64_t next = i + 1 < image.header.sections
+                                ? getU64(table + 8 * (i + 1))
+                                : size;
+
+            if ((i == 0 && offset != 0) || offset < prev || next < offset ||
+                next > size)
+                return false;
+
+            out.push_back({records + offset, records + next});
+            prev = offset;
+        }
+
+        return true;
+    }
+
+    ChunkWriter::ChunkWriter(size_t chunkBytes, const Sink &sink)
+        : chunk_bytes_(chunkBytes), sink_(sink)
+    {
+        buffer_.reserve(chunkBytes);
+    }
+
+    bool ChunkWriter::append(const char *data, size_t size)
+    {
+        if (buffer_.size() + size > chunk_bytes_ && !flush())
+            return false;
+
+        if (size >= chunk_bytes_)
+            return emit(data, size);
+
+        buffer_.append(data, size);
+        return true;
+    }
+
+    bool ChunkWriter::flush()
+    {
+        bool ok = buffer_.empty() || emit(buffer_.data(), buffer_.size());
+        buffer_.clear();
+        return ok;
+    }
+
+    bool ChunkWriter::emit(const char *data, size_t size)
+    {
+        crc_ = crc32c(crc_, data, size);
+        return sink_(data, size);
+    }
+
+    bool merge(const std::vector<Image> &chain, size_t chunkBytes,
+               const Sink &sink)
+    {
+        if (!isChain(chain))
+            return false;
+
+        for (const Image &image : chain)
+        {
+            if (!verifyChecksum(image.data, image.size))
+                return false;
+        }
+
+        // Newest value of each key the deltas wrote, pointing into the
+        // images.
+        std::unordered_map<std::string_view, std::string_view> newer;
+
+        for (size_t i = 1; i < chain.size(); ++i)
+        {
+            bool ok = forEachRecord(chain[i], [&](std::string_view key,
+                                                  std::string_view value)
+                                    { newer[key] = value; });
+            if (!ok)
+                return false;
+        }
+
+        Header header;
+        header.last_index = chain.back().header.last_index;
+        header.last_term = chain.back().header.last_term;
+
+        auto count = [&header](std::string_view key, std::string_view value)
+        {
+            header.records++;
+            header.data_bytes += RECORD_HEADER_BYTES + key.size() + value.size();
+        };
+
+        for (const auto &[key, value] : newer)
+            count(key, value);
+
+        bool ok = forEachRecord(chain.front(), [&](std::string_view key,
+                                                   std::string_view value)
+                                { if (!newer.count(key)) count(key, value); });
+        if (!ok)
+            return false;
+
+        // Sections are cut at the first record boundary past each share
+        // of the records; any left over at the end are empty.
+        uint64_t size = header.data_bytes;
+        uint64_t share = size / MERGE_SECTIONS + 1;
+        std::vector<uint64_t> offsets;
+        uint64_t bytes = 0;
+
+        header.sections = MERGE_SECTIONS;
+        header.data_bytes += sectionTableBytes(MERGE_SECTIONS);
+
+        ChunkWriter out(chunkBytes, sink);
+        char head[HEADER_BYTES];
+        encodeHeader(header, head);
+
+        if (!out.append(head, sizeof(head)))
+            return false;
+
+        // Stops copying at the first failed write.
+        bool written = true;
+
+        auto copy = [&](std::string_view key, std::string_view value)
+        {
+            if (offsets.size() < MERGE_SECTIONS &&
+                bytes >= offsets.size() * share)
+                offsets.push_back(bytes);
+
+            written = appendRecord(out, key, value);
+            bytes += RECORD_HEADER_BYTES + key.size() + value.size();
+        };
+
+        forEachRecord(chain.front(), [&](std::string_view key,
+                                         std::string_view value)
+                      {
+                          if (written && !newer.count(key))
+                              copy(key, value);
+                      });
+
+        for (const auto &[key, value] : newer)
+        {
+            if (!written)
+                break;
+            copy(key, value);
+        }
+
+        offsets.resize(MERGE_SECTIONS, bytes);
+        std::string table = encodeSections(offsets);
+
+        if (!written || bytes != size ||
+            !out.append(table.data(), table.size()) || !out.flush())
+            return false;
+
+        char crc[TRAILER_BYTES];
+        putU32(crc, out.crc());
+        return out.append(crc, sizeof(crc)) && out.flush();
+    }
+}
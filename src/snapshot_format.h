@@ -0,0 +1,174 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// On-disk and on-wire snapshot image, version 1. All integers are
+// little-endian.
+//
+//   header   magic "KVSNAP\r\n", u32 version, u32 flags,
+//            u64 last_index, u64 last_term, u64 records, u64 data_bytes
+//   records  { u32 key_len, u32 value_len, key, value } * records
+//   sections (FLAG_SECTIONS) u64 offset * n, u32 n
+//   trailer  u32 CRC-32C of header, records and sections
+//
+// data_bytes covers the records and the section table. The header gives
+// the record count and size up front, so a reader can size its tables
+// before decoding, and the trailer lets a writer stream records without
+// going back. The section table splits the records into n runs, each
+// starting at its offset from the first record, so they can be decoded
+// in parallel. Its size follows from n, which the writer fixes up front.
+//
+// A full image holds every key. A delta (FLAG_DELTA) holds only the keys
+// written since the image before it, so a snapshot is a chain: one full
+// image, then deltas at increasing indices, with later records winning.
+// A file may hold several images end to end.
+namespace snapshot_format
+{
+    constexpr char MAGIC[8] = {'K', 'V', 'S', 'N', 'A', 'P', '\r', '\n'};
+    constexpr uint32_t VERSION = 1;
+    constexpr size_t HEADER_BYTES = 48;
+    constexpr size_t RECORD_HEADER_BYTES = 8;
+    constexpr size_t TRAILER_BYTES = 4;
+    constexpr uint32_t FLAG_DELTA = 1;
+    constexpr uint32_t FLAG_SECTIONS = 2;
+
+    struct Header
+    {
+        bool delta = false;
+        uint64_t last_index = 0;
+        uint64_t last_term = 0;
+        uint64_t records = 0;
+        uint64_t data_bytes = 0;
+
+        // Entries in the section table, or 0 if there is none. Set by
+        // decodeHeader; writers set it to have encodeHeader flag it.
+        uint32_t sections = 0;
+    };
+
+    // Bytes the section table of n sections takes.
+    inline uint64_t sectionTableBytes(uint32_t n)
+    {
+        return n == 0 ? 0 : 8 * (uint64_t)n + 4;
+    }
+
+    // Bytes of records, without the section table.
+    inline uint64_t recordBytes(const Header &header)
+    {
+        return header.data_bytes - sectionTableBytes(header.sections);
+    }
+
+    inline void putU32(char *out, uint32_t v)
+    {
+        for (int i = 0; i < 4; ++i)
+            out[i] = static_cast<char>(v >> (8 * i));
+    }
+
+    inline void putU64(char *out, uint64_t v)
+    {
+        for (int i = 0; i < 8; ++i)
+            out[i] = static_cast<char>(v >> (8 * i));
+    }
+
+    inline uint32_t getU32(const char *in)
+    {
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i)
+            v |= (uint32_t)(uint8_t)in[i] << (8 * i);
+        return v;
+    }
+
+    inline uint64_t getU64(const char *in)
+    {
+        uint64_t v = 0;
+        for (int i = 0; i < 8; ++i)
+            v |= (uint64_t)(uint8_t)in[i] << (8 * i);
+        return v;
+    }
+
+    void encodeHeader(const Header &header, char out[HEADER_BYTES]);
+
+    // Checks magic, version, and that size matches the header's
+    // data_bytes and section count. Does not verify the checksum.
+    bool decodeHeader(const char *data, size_t size, Header &header);
+
+    // Encodes a section table of offsets.size() entries.
+    std::string encodeSections(const std::vector<uint64_t> &offsets);
+
+    // Whether the trailer matches the checksum of everything before it.
+    bool verifyChecksum(const char *data, size_t size);
+
+    // One image within a mapped file.
+    struct Image
+    {
+        const char *data;
+        size_t size;
+        Header header;
+    };
+
+    // Splits a file into the images laid end to end in it. False if any
+    // of them is truncated or has a bad header; checksums are left to
+    // the reader.
+    bool split(const char *data, size_t size, std::vector<Image> &images);
+
+    // Whether images form a chain: a full image, then deltas at
+    // increasing indices.
+    bool isChain(const std::vector<Image> &images);
+
+    // A run of whole records.
+    struct Section
+    {
+        const char *begin;
+        const char *end;
+    };
+
+    // Appends image's sections in order; one covering every record if it
+    // has no section table. False if the offsets are out of order or out
+    // of range. Whether they fall on record boundaries shows only when
+    // the sections are decoded.
+    bool sections(const Image &image, std::vector<Section> &out);
+
+    // Takes an image a chunk at a time, in order. Returns false to stop.
+    using Sink = std::function<bool(const char *data, size_t size)>;
+
+    // Gathers small appends into chunks for a sink, checksumming
+    // everything it passes on. Anything a chunk or bigger goes straight
+    // through.
+    class ChunkWriter
+    {
+    public:
+        ChunkWriter(size_t chunkBytes, const Sink &sink);
+
+        bool append(const char *data, size_t size);
+        bool flush();
+
+        // Of everything flushed so far.
+        uint32_t crc() const { return crc_; }
+
+    private:
+        bool emit(const char *data, size_t size);
+
+        size_t chunk_bytes_;
+        const Sink &sink_;
+        std::string buffer_;
+        uint32_t crc_ = 0;
+    };
+
+    // Collapses a chain into one full image stamped with the last link's
+    // index and term: each key once, with its newest value, in
+    // MERGE_SECTIONS sections of about equal size. Verifies every
+    // checksum first. Holds an index of the deltas' keys (not their
+    // values) in memory; the full image is read twice from the page
+    // cache, once to size the header and once to copy it.
+    constexpr uint32_t MERGE_SECTIONS = 64;
+
+    bool merge(const std::vector<Image> &chain, size_t chunkBytes,
+               const Sink &sink);
+
+    // CRC-32C (Castagnoli), chainable: crc32c(crc32c(0, a), b) is the
+    // checksum of a followed by b. Uses the SSE4.2 instruction when the
+    // CPU has it.
+    uint32_t crc32c(uint32_t crc, const void *data, size_t size);
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "slab_allocator.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+
+// Immutable, reference-counted value bytes. The store holds one
+// reference; a Get takes another and hands the bytes to gRPC as a slice,
+// so serving a read never copies the value. Header and bytes share one
+// slab block.
+class ValueBuffer
+{
+public:
+    // Returns a buffer holding a copy of bytes, with one reference.
+    // version orders the store's writes for point-in-time snapshots.
+    static ValueBuffer *create(const char *bytes, size_t size, uint64_t version = 0)
+    {
+        void *mem = SlabAllocator::global().allocate(sizeof(ValueBuffer) + size);
+        ValueBuffer *buffer = new (mem) ValueBuffer(size, version);
+        std::memcpy(const_cast<char *>(buffer->data()), bytes, size);
+        return buffer;
+    }
+
+    static ValueBuffer *create(const std::string &bytes, uint64_t version = 0)
+    {
+        return create(bytes.data(), bytes.size(), version);
+    }
+
+    const char *data() const { return reinterpret_cast<const char *>(this + 1); }
+    size_t size() const { return size_; }
+    uint64_t version() const { return version_; }
+
+    void ref() { refs_.fetch_add(1, std::memory_order_relaxed); }
+
+    void unref()
+    {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            size_t bytes = sizeof(ValueBuffer) + size_;
+            this->~ValueBuffer();
+            SlabAllocator::global().deallocate(this, bytes);
+        }
+    }
+
+private:
+    ValueBuffer(size_t size, uint64_t version)
+        : refs_(1), size_((uint32_t)size), version_(version) {}
+    ~ValueBuffer() = default;
+
+    // 32-bit size keeps the header at 16 bytes; values are bounded by
+    // gRPC's message limit anyway.
+    std::atomic<uint32_t> refs_;
+    uint32_t size_;
+    uint64_t version_;
+};
+
+// Owning handle to a ValueBuffer.
+class ValueRef
+{
+public:
+    ValueRef() = default;
+
+    // Takes over a reference the caller already holds.
+    explicit ValueRef(ValueBuffer *buffer) : buffer_(buffer) {}
+
+    ValueRef(const ValueRef &other) : buffer_(other.buffer_)
+    {
+        if (buffer_)
+            buffer_->ref();
+    }
+
+    ValueRef(ValueRef &&other) noexcept : buffer_(other.buffer_)
+    {
+        other.buffer_ = nullptr;
+    }
+
+    ValueRef &operator=(ValueRef other) noexcept
+    {
+        std::swap(buffer_, other.buffer_);
+        return *this;
+    }
+
+    ~ValueRef()
+    {
+        if (buffer_)
+            buffer_->unref();
+    }
+
+    explicit operator bool() const { return buffer_ != nullptr; }
+
+    const char *data() const { return buffer_ ? buffer_->data() : nullptr; }
+    size_t size() const { return buffer_ ? buffer_->size() : 0; }
+
+    std::string str() const { return std::string(data(), size()); }
+
+    // Gives up ownership; the caller must unref().
+    ValueBuffer *release()
+    {
+        ValueBuffer *buffer = buffer_;
+        buffer_ = nullptr;
+        return buffer;
+    }
+
+private:
+    ValueBuffer *buffer_ = nullptr;
+};
@@ -0,0 +1,156 @@
+// Follower side of AppendEntries: log matching and the commit index.
+//
+//   replication_test
+//
+// Drives ReplicationServiceImpl directly with packets from a leader that
+// is not there, against a fresh WAL in a temporary directory. Exits
+// non-zero if any check fails.
+
+#include "node.h"
+#include "rpc_server.h"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                 \
+    do                                                              \
+    {                                                               \
+        if (!(cond))                                                \
+        {                                                           \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n",       \
+                         __FILE__, __LINE__, #cond);                \
+            failures++;                                             \
+        }                                                           \
+    } while (0)
+
+// Entries as (index, term); the key and value are derived from them.
+static kv::ReplicationAck replicate(ReplicationServiceImpl &service,
+                                    int64_t term,
+                                    int64_t prevIndex,
+                                    int64_t prevTerm,
+                                    const std::vector<std::pair<int64_t, int64_t>> &entries,
+                                    int64_t commitIndex)
+{
+    kv::ReplicationPacket packet;
+    packet.set_term(term);
+    packet.set_commit_index(commitIndex);
+    packet.set_from_index(prevIndex + 1);
+    packet.set_prev_log_index(prevIndex);
+    packet.set_prev_log_term(prevTerm);
+
+    for (const auto &[index, entryTerm] : entries)
+    {
+        kv::Operation *op = packet.add_ops();
+        op->set_index(index);
+        op->set_term(entryTerm);
+        op->set_key("k" + std::to_string(index));
+        op->set_value("t" + std::to_string(entryTerm));
+    }
+
+    kv::ReplicationAck ack;
+    service.Replicate(nullptr, &packet, &ack);
+    return ack;
+}
+
+// The follower's suffix runs past the packet and diverges from the
+// leader there; nothing past the packet may commit.
+static void divergentSuffixPastPacket(Node &node, ReplicationServiceImpl &service)
+{
+    // Term 1 leader: entries 1-5, none committed.
+    kv::ReplicationAck ack =
+        replicate(service, 1, 0, 0, {{1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}}, 0);
+    CHECK(ack.success());
+    CHECK(node.lastIndex() == 5);
+
+    // Term 2 leader holds 1-3 from term 1 and 4 from term 2, and has
+    // committed 4. It resends 3 only, which we already hold.
+    ack = replicate(service, 2, 2, 1, {{3, 1}}, 4);
+    CHECK(ack.success());
+    CHECK(node.commitIndex() == 3);
+    CHECK(node.termAt(4) == 1);
+
+    // Entry 4 repairs the suffix and can now commit.
+    ack = replicate(service, 2, 3, 1, {{4, 2}}, 4);
+    CHECK(ack.success());
+    CHECK(node.termAt(4) == 2);
+    CHECK(node.lastIndex() == 4);
+    CHECK(node.commitIndex() == 4);
+}
+
+// A packet whose previous entry we hold with another term is rejected,
+// and the leader is pointed before it.
+static void prevTermMismatch(Node &node, ReplicationServiceImpl &service)
+{
+    kv::ReplicationAck ack = replicate(service, 3, 4, 3, {{5, 3}}, 5);
+    CHECK(!ack.success());
+    CHECK(ack.last_index() == 3);
+    CHECK(node.lastIndex() == 4);
+    CHECK(node.commitIndex() == 4);
+}
+
+// A gap past our last entry is rejected with where our log ends.
+static void gap(Node &node, ReplicationServiceImpl &service)
+{
+    kv::ReplicationAck ack = replicate(service, 3, 7, 3, {{8, 3}}, 8);
+    CHECK(!ack.success());
+    CHECK(ack.last_index() == 4);
+    CHECK(node.lastIndex() == 4);
+}
+
+// A late packet with an older commit index leaves commit where it is.
+static void commitNeverMovesBack(Node &node, ReplicationServiceImpl &service)
+{
+    kv::ReplicationAck ack = replicate(service, 3, 0, 0, {{1, 1}}, 1);
+    CHECK(ack.success());
+    CHECK(node.commitIndex() == 4);
+    CHECK(node.lastIndex() == 4);
+}
+
+// A new leader catching us up sends entries from earlier terms; they
+// are stored, not dropped as stale.
+static void earlierTermEntriesStored(Node &node, ReplicationServiceImpl &service)
+{
+    kv::ReplicationAck ack = replicate(service, 4, 4, 2, {{5, 3}, {6, 3}}, 6);
+    CHECK(ack.success());
+    CHECK(ack.last_index() == 6);
+    CHECK(node.lastIndex() == 6);
+    CHECK(node.termAt(5) == 3);
+    CHECK(node.termAt(6) == 3);
+    CHECK(node.commitIndex() == 6);
+}
+
+int main()
+{
+    namespace fs = std::filesystem;
+
+    fs::path dir = fs::temp_directory_path() /
+                   ("replication_test_" + std::to_string(getpid()));
+    fs::remove_all(dir);
+
+    {
+        Node node(dir.string(), {});
+        ReplicationServiceImpl service(&node);
+
+        divergentSuffixPastPacket(node, service);
+        prevTermMismatch(node, service);
+        gap(node, service);
+        commitNeverMovesBack(node, service);
+        earlierTermEntriesStored(node, service);
+    }
+
+    fs::remove_all(dir);
+
+    if (failures)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    std::printf("ok\n");
+    return 0;
+}